@@ -63,6 +63,7 @@
 #include "java_access/BigInteger.h"
 #include "java_access/Boolean.h"
 #include "java_access/Buffer.h"
+#include "java_access/BulkConverter.h"
 #include "java_access/Byte.h"
 #include "java_access/ByteBuffer.h"
 #include "java_access/ByteOrder.h"
@@ -102,4 +103,6 @@
 #include "java_access/Short.h"
 #include "java_access/ShortBuffer.h"
 #include "java_access/String.h"
+#include "java_access/System.h"
 #include "java_access/Throwable.h"
+#include "java_access/UndeclaredThrowableException.h"
@@ -65,5 +65,12 @@ PyObject* jstring_As_PyString(JNIEnv*, jstring);
  */
 PyObject* jobject_As_PyString(JNIEnv*, jobject);
 
+/*
+ * Convert all the elements of an array returned from jep.BulkConverter to a
+ * new Python list. The array is an Object[] or an int[], long[], double[] or
+ * boolean[] of unboxed values.
+ */
+PyObject* jvalues_As_PyList(JNIEnv*, jobject);
+
 
 #endif // ifndef _Included_convert_j2p
@@ -29,6 +29,7 @@
 #define _Included_java_lang_Boolean
 
 jobject java_lang_Boolean_new_Z(JNIEnv*, jboolean);
+jobject java_lang_Boolean_valueOf(JNIEnv*, jboolean);
 jboolean java_lang_Boolean_booleanValue(JNIEnv*, jobject);
 
 #endif // ndef java_lang_Boolean
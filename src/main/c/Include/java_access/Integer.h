@@ -29,5 +29,6 @@
 #define _Included_java_lang_Integer
 
 jobject java_lang_Integer_new_I(JNIEnv*, jint);
+jobject java_lang_Integer_valueOf(JNIEnv*, jint);
 
 #endif // ndef java_lang_Integer
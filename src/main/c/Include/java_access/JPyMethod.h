@@ -30,5 +30,6 @@
 
 jboolean jep_PyMethod_varargs(JNIEnv*, jobject);
 jboolean jep_PyMethod_kwargs(JNIEnv*, jobject);
+jboolean jep_PyMethod_releaseGIL(JNIEnv*, jobject);
 
 #endif // ndef jep_PyMethod
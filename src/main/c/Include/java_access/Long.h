@@ -29,5 +29,6 @@
 #define _Included_java_lang_Long
 
 jobject java_lang_Long_new_J(JNIEnv*, jlong);
+jobject java_lang_Long_valueOf(JNIEnv*, jlong);
 
 #endif // ndef java_lang_Long
@@ -35,4 +35,12 @@ jint    java_lang_Number_intValue(JNIEnv*, jobject);
 jlong   java_lang_Number_longValue(JNIEnv*, jobject);
 jshort  java_lang_Number_shortValue(JNIEnv*, jobject);
 
+// only for boxed primitives, these keep the GIL
+jbyte   java_lang_Number_byteValue_boxed(JNIEnv*, jobject);
+jdouble java_lang_Number_doubleValue_boxed(JNIEnv*, jobject);
+jfloat  java_lang_Number_floatValue_boxed(JNIEnv*, jobject);
+jint    java_lang_Number_intValue_boxed(JNIEnv*, jobject);
+jlong   java_lang_Number_longValue_boxed(JNIEnv*, jobject);
+jshort  java_lang_Number_shortValue_boxed(JNIEnv*, jobject);
+
 #endif // ndef java_lang_Number
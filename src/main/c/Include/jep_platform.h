@@ -34,6 +34,7 @@
 // Python.h needs to be included first, see http://bugs.python.org/issue1045893
 #include <Python.h>
 #include <assert.h>
+#include <stddef.h>
 
 #if PY_MAJOR_VERSION < 3
     static_assert(PY_MAJOR_VERSION >= 3,"There is no Python 2 support!");
@@ -79,4 +80,26 @@
     */
     #define JLOCAL_REFS 16
 
+    /*
+    * Vectorcall(PEP 590) is part of the public API starting with Python 3.9.
+    * When it is available the jep callables implement it so that calling a
+    * java method does not need to create a bound method or an args tuple.
+    */
+    #if PY_MAJOR_VERSION > 3 || PY_MINOR_VERSION >= 9
+        #define JEP_VECTORCALL 1
+    #else
+        #define JEP_VECTORCALL 0
+    #endif
+
+    /*
+    * Like Py_BEGIN_ALLOW_THREADS and Py_END_ALLOW_THREADS but the GIL is only
+    * released if release is true. Keeping the GIL is faster for short calls
+    * into java but it is only safe for calls that do not block and do not
+    * call back into python, the thread would wait forever for the GIL.
+    */
+    #define JEP_BEGIN_ALLOW_THREADS_IF(release) { \
+        PyThreadState *_save = (release) ? PyEval_SaveThread() : NULL;
+    #define JEP_END_ALLOW_THREADS_IF \
+        if (_save) { PyEval_RestoreThread(_save); } }
+
 #endif // ifndef _Included_jep_platform
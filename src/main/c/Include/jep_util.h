@@ -58,10 +58,22 @@ void unref_cache_primitive_classes(JNIEnv*);
 int cache_frequent_classes(JNIEnv*);
 void unref_cache_frequent_classes(JNIEnv*);
 
+// sets up the canonical boxes for booleans and small integers
+int cache_boxed_values(JNIEnv*);
+void unref_cache_boxed_values(JNIEnv*);
+
 int get_jtype(JNIEnv*, jclass);
 int pyarg_matches_jtype(JNIEnv*, PyObject*, jclass, int);
 jvalue convert_pyarg_jvalue(JNIEnv*, PyObject*, jclass, int, int);
 
+// create a new tuple containing the items of a C array of python objects.
+PyObject* pyargs_as_tuple(PyObject *const*, Py_ssize_t);
+
+#if JEP_VECTORCALL
+// create a new dict from the keyword values and names of a vectorcall.
+PyObject* kwnames_as_dict(PyObject *const*, PyObject*);
+#endif
+
 #define JBOOLEAN_ID 0
 #define JINT_ID     1
 #define JLONG_ID    2
@@ -96,6 +108,22 @@ extern jclass JLONG_ARRAY_TYPE;
 extern jclass JFLOAT_ARRAY_TYPE;
 extern jclass JDOUBLE_ARRAY_TYPE;
 
+/*
+ * Global references to the canonical Java boxes for booleans and for the
+ * integers from JBOX_CACHE_LOW to JBOX_CACHE_HIGH. The range matches the
+ * range that Integer.valueOf() and Long.valueOf() are required to cache so a
+ * value converted from Python is the same object Java code would get from
+ * autoboxing.
+ */
+#define JBOX_CACHE_LOW  -128
+#define JBOX_CACHE_HIGH 127
+#define JBOX_CACHE_SIZE (JBOX_CACHE_HIGH - JBOX_CACHE_LOW + 1)
+
+extern jobject JBOOLEAN_TRUE;
+extern jobject JBOOLEAN_FALSE;
+extern jobject JINTEGER_CACHE[JBOX_CACHE_SIZE];
+extern jobject JLONG_CACHE[JBOX_CACHE_SIZE];
+
 /*
  * CLASS_TABLE contains the definition for all the classes that we cache for
  * easy access. Tyically a macro is passed to CLASS_TABLE macro and it will be
@@ -144,8 +172,12 @@ extern jclass JDOUBLE_ARRAY_TYPE;
     F(JARRAYLIST_TYPE, "java/util/ArrayList") \
     F(JHASHMAP_TYPE, "java/util/HashMap") \
     F(JCOLLECTIONS_TYPE, "java/util/Collections") \
+    F(JRANDOMACCESS_TYPE, "java/util/RandomAccess") \
     F(JCLASSLOADER_TYPE, "java/lang/ClassLoader") \
+    F(JSYSTEM_TYPE, "java/lang/System") \
     F(JEP_PROXY_TYPE, "jep/Proxy") \
+    F(JEP_BULKCONVERTER_TYPE, "jep/BulkConverter") \
+    F(JEP_FUNCTIONALPROXY_TYPE, "jep/python/FunctionalProxy") \
     F(CLASSNOTFOUND_EXC_TYPE, "java/lang/ClassNotFoundException") \
     F(INDEX_EXC_TYPE, "java/lang/IndexOutOfBoundsException") \
     F(IO_EXC_TYPE, "java/io/IOException") \
@@ -154,6 +186,9 @@ extern jclass JDOUBLE_ARRAY_TYPE;
     F(ARITHMETIC_EXC_TYPE, "java/lang/ArithmeticException") \
     F(OUTOFMEMORY_EXC_TYPE, "java/lang/OutOfMemoryError") \
     F(ASSERTION_EXC_TYPE, "java/lang/AssertionError") \
+    F(RUNTIME_EXC_TYPE, "java/lang/RuntimeException") \
+    F(ERROR_EXC_TYPE, "java/lang/Error") \
+    F(UNDECLARED_EXC_TYPE, "java/lang/reflect/UndeclaredThrowableException") \
     F(JEP_EXC_TYPE, "jep/JepException") \
     F(JPYOBJECT_TYPE, "jep/python/PyObject") \
     F(JPYCALLABLE_TYPE, "jep/python/PyCallable") \
@@ -26,6 +26,8 @@
 */
 
 #include "jep_platform.h"
+#include "pyjobject.h"
+#include "pyjtype.h"
 
 #ifndef _Included_pyembed
 #define _Included_pyembed
@@ -42,11 +44,42 @@ struct __JepThread {
 };
 typedef struct __JepThread JepThread;
 
+/*
+ * The state of the _jep module. Every interpreter has a separate _jep module
+ * so anything stored here is not shared between interpreters.
+ */
+typedef struct {
+    PyJTypeCache   typeCache;
+    /*
+     * dict of a type to True or False for whether the type has a
+     * _to_python converter, cleared when a converter is registered
+     */
+    PyObject      *j2pConverters;
+    /*
+     * Java Strings up to stringCacheLength characters are converted to a
+     * str from stringCache, an array of JEP_STRING_CACHE_SIZE strings that
+     * is allocated the first time it is used. 0 disables the cache.
+     */
+    int            stringCacheLength;
+    PyObject     **stringCache;
+    /* The chunk size for iterating a java.lang.Iterable, 0 until it is set */
+    int            iteratorChunkSize;
+    /* The wrappers of Java objects, when enabled with setJavaObjectCache */
+    PyJObjectCache objectCache;
+} JepModuleState;
+
+/* The number of strings in the string cache, must be a power of 2 */
+#define JEP_STRING_CACHE_SIZE 1024
+
+/* Release all the strings in the string cache */
+void pyembed_clear_string_cache(JepModuleState*);
+
 
 void pyembed_preinit(JNIEnv*, jint, jint, jint, jint, jint, jint, jint,
                      jstring, jstring);
 void pyembed_startup(JNIEnv*, jobjectArray);
 void pyembed_shutdown(JavaVM*);
+void pyembed_set_jvm(JavaVM*);
 void pyembed_shared_import(JNIEnv*, jstring);
 
 intptr_t pyembed_thread_init(JNIEnv*, jobject, jobject, jboolean, jboolean,
@@ -69,6 +102,9 @@ jobject pyembed_getvalue(JNIEnv*, intptr_t, char*, jclass);
 JNIEnv* pyembed_get_env(void);
 JepThread* pyembed_get_jepthread(void);
 PyObject* pyembed_get_jep_module(void);
+JepModuleState* pyembed_get_module_state(void);
+// NULL without an exception if _jep is not available, for optional caches
+JepModuleState* pyembed_find_module_state(void);
 
 // -------------------------------------------------- set() methods
 
@@ -44,10 +44,15 @@ typedef struct {
     int              length;         /* better than querying all the time */
     void            *pinnedArray;    /* i.e.: cast to (int *) for an int array */
     jboolean         isCopy;         /* true if pinned array was copied */
+    Py_ssize_t       exportShape;    /* shape of buffers exported from the pinned array */
+    int              exports;        /* number of buffers exported from the pinned array */
+    int              dirty;          /* true if python wrote to or exported the pinned copy since the last commit */
+    int              stale;          /* true if java may have modified the array since it was pinned */
 } PyJArrayObject;
 
 PyObject* pyjarray_new(JNIEnv*, jobjectArray);
 PyObject* pyjarray_new_v(PyObject*, PyObject*);
+PyObject* pyjarray_from_buffer(PyObject*, PyObject*);
 int pyjarray_check(PyObject*);
 void pyjarray_release_pinned(PyJArrayObject*, jint);
 void pyjarray_pin(PyJArrayObject*);
@@ -48,6 +48,10 @@ typedef struct {
     PyObject *constructor;
     /* A python dict containing fields, methods, and inner classes */
     PyObject *attr;
+#if JEP_VECTORCALL
+    /* calls the constructor, used by PyObject_Vectorcall */
+    vectorcallfunc vectorcall;
+#endif
 } PyJClassObject;
 
 PyObject* PyJClass_Wrap(JNIEnv*, jobject);
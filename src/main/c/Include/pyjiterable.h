@@ -39,4 +39,7 @@
 
 extern PyType_Spec PyJIterable_Spec;
 
+/* Get a Python iterator wrapping the java.util.Iterator of the Iterable */
+PyObject* pyjiterable_getiter(PyObject*);
+
 #endif // ndef pyjiterable
@@ -39,6 +39,11 @@ extern PyTypeObject PyJMethod_Type;
  * to a PyJObject using setattr. Most of the fields in this object are lazy
  * loaded and care should be taken to ensure they are populated before accessing
  * them. The only fields that are not lazily loaded are rmethod and pyMethodName.
+ *
+ * Once initialized the signature of the method (parameterTypes,
+ * parameterTypeIds, varArgsComponentType and returnTypeId) is never modified,
+ * so calls can convert arguments without asking the JVM about the parameter
+ * types again.
  */
 typedef struct {
     PyObject_HEAD
@@ -46,11 +51,19 @@ typedef struct {
     jobject           rmethod;             /* reflect/Method object */
     int               returnTypeId;        /* type id of return */
     PyObject         *pyMethodName;        /* python name... :-) */
-    jobjectArray      parameters;          /* array of jclass parameter types */
-    int               lenParameters;       /* length of parameters above */
+    jclass           *parameterTypes;      /* global refs to the parameter types */
+    int              *parameterTypeIds;    /* type ids of parameterTypes */
+    int               lenParameters;       /* length of parameters, -1 until initialized */
+    jclass            varArgsComponentType;   /* component type of the last parameter if it is an array */
+    int               varArgsComponentTypeId; /* type id of varArgsComponentType */
     int               isStatic;            /* if method is static */
     int               isVarArgs;           /* if the method takes varargs */
     int               isKwArgs;            /* if the method takes kwargs */
+    int               needsLocalFrame;     /* if calls push a local frame for their references */
+    int               releaseGIL;          /* if the GIL is released during calls */
+#if JEP_VECTORCALL
+    vectorcallfunc    vectorcall;          /* used by PyObject_Vectorcall */
+#endif
 } PyJMethodObject;
 
 /* Create a new PyJMethod from a java.lang.reflect.Method*/
@@ -66,7 +79,17 @@ int PyJMethod_Check(PyObject *obj);
 int PyJMethod_GetParameterCount(PyJMethodObject*, JNIEnv*);
 
 /*
- * Check if a method is compatible with the types of a tuple of arguments.
+ * Build the parameter portion of the signature from the jclass array returned
+ * by Executable.getParameterTypes(). This is shared by PyJMethod and
+ * PyJConstructor initialization and must only be called once per object.
+ * Returns 1 on success, 0 on failure with a python exception set.
+ */
+int PyJMethod_InitParameters(PyJMethodObject*, JNIEnv*, jobjectArray);
+
+/*
+ * Check if a method is compatible with the types of an array of arguments.
+ * The first argument is self and is not checked, the last argument should be
+ * non-zero if keyword arguments were given.
  * This will return a 0 if the arguments are not valid for this method and a
  * positive integer if the arguments are valid. Returns a negative value on error. 
  * Larger numbers indicate a better match between the arguments and the expected parameter types.
@@ -74,6 +97,7 @@ int PyJMethod_GetParameterCount(PyJMethodObject*, JNIEnv*);
  * This function does not need to be called before using calling this method, it is only
  * necessary for resolving method overloading.
  */
-int PyJMethod_CheckArguments(PyJMethodObject*, JNIEnv*, PyObject*, PyObject*);
+int PyJMethod_CheckArguments(PyJMethodObject*, JNIEnv*, PyObject *const*,
+                             Py_ssize_t, int);
 
 #endif // ndef pyjmethod
@@ -38,6 +38,14 @@ extern PyTypeObject PyJMultiMethod_Type;
 typedef struct {
     PyObject_HEAD
     PyObject* methodList;
+    /*
+     * Maps a tuple of python argument types to the method that was selected
+     * for those types so overloads do not need to be scored on every call.
+     */
+    PyObject* dispatchCache;
+#if JEP_VECTORCALL
+    vectorcallfunc vectorcall;
+#endif
 } PyJMultiMethodObject;
 
 /*
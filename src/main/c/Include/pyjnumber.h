@@ -29,6 +29,10 @@
  * A PyJNumberObject is a PyJObject with some extra methods attached to meet
  * the Python Number protocol/interface.  It should only be used where the
  * underlying jobject of the PyJObject is an implementation of java.lang.Number.
+ *
+ * The boxed primitives like java.lang.Integer are immutable so the Python int
+ * or float for them is created the first time it is needed and kept in the
+ * PyJNumberObject. Other Numbers are converted for every operation.
  */
 
 #include "jep_platform.h"
@@ -37,6 +41,12 @@
 #ifndef _Included_pyjnumber
 #define _Included_pyjnumber
 
+typedef struct {
+    PyObject_HEAD
+    PyJObject_FIELDS
+    PyObject *value;    /* the Python value of a boxed primitive or NULL */
+} PyJNumberObject;
+
 extern PyType_Spec PyJNumber_Spec;
 
 #endif // ndef pyjnumber
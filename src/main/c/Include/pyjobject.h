@@ -56,9 +56,40 @@ typedef struct {
  * Create a new instance of PyJObject or one of it's subtypes that wraps
  * the object provided. If the class of the object is known it can be passed
  * in, or the final argument can be NULL and this function will figure it out.
+ * When the type was created by PyJType_Get for the class of the object the
+ * instance shares the reference to the class held by the type.
  */
 PyObject* PyJObject_New(JNIEnv*, PyTypeObject*, jobject, jclass);
 
+/*
+ * A cache of the wrappers that are alive for Java objects so converting the
+ * same Java object again returns the same wrapper. Entries are keyed on the
+ * identity hash code of the Java object and do not hold a reference to the
+ * wrapper, a wrapper removes its entry when it is deallocated. Each
+ * interpreter has a separate cache in the state of the _jep module, the cache
+ * is disabled until it is enabled with jep.setJavaObjectCache().
+ */
+typedef struct PyJObjectCacheEntry PyJObjectCacheEntry;
+typedef struct {
+    int                  enabled;
+    Py_ssize_t           size;      /* number of entries in use */
+    Py_ssize_t           capacity;  /* length of entries, a power of 2 */
+    PyJObjectCacheEntry *entries;
+} PyJObjectCache;
+
+/*
+ * Same as PyJObject_New except that when the cache of the interpreter is
+ * enabled an existing wrapper of the same type for the object is returned
+ * and a new wrapper is added to the cache.
+ */
+PyObject* PyJObject_NewCached(JNIEnv*, PyTypeObject*, jobject, jclass);
+
+/*
+ * Enable or disable a cache. Disabling the cache removes all the entries,
+ * for the m_free of the _jep module the cache is disabled.
+ */
+void PyJObject_SetCacheEnabled(PyJObjectCache*, int);
+
 #define PyJObject_Check(pyobj) \
     PyObject_TypeCheck(pyobj, &PyJObject_Type)
 
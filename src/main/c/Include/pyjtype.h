@@ -30,9 +30,66 @@
 #ifndef _Included_pyjtype
 #define _Included_pyjtype
 
+/*
+ * A cache of the Python types created for Java classes and of how instances of
+ * the classes are converted to Python. Entries are keyed on the identity of
+ * the Java class so classes with the same name from different ClassLoaders
+ * will have different types. Each interpreter has a separate cache in the
+ * state of the _jep module.
+ */
+typedef struct PyJTypeCacheEntry PyJTypeCacheEntry;
+typedef struct {
+    Py_ssize_t         size;      /* number of entries in use */
+    Py_ssize_t         capacity;  /* length of entries, a power of 2 */
+    PyJTypeCacheEntry *entries;
+} PyJTypeCache;
+
 /*
  * Get a PyTypeObject for the java class provided.
  */
 PyTypeObject* PyJType_Get(JNIEnv*, jclass);
 
+/*
+ * Get the global reference to the java class of a type created by
+ * PyJType_Get, or NULL for other types. The reference is owned by the type so
+ * instances of the type can share it instead of creating their own.
+ */
+jclass PyJType_GetClass(PyTypeObject*);
+
+/*
+ * Get the conversion kind stored for a class with PyJType_SetKind, 0 if none
+ * is stored. The type is set to a borrowed reference to the type of the class
+ * or NULL if no type has been created yet. If the _jep module is not
+ * available nothing is cached and 0 is returned. Returns -1 if an error
+ * occurs.
+ */
+int PyJType_GetKind(JNIEnv*, jclass, int*, PyTypeObject**);
+
+/*
+ * Store a conversion kind for a class so the checks that determine how to
+ * convert an instance of the class only need to run once for each class.
+ * Does nothing if the _jep module is not available. Returns -1 if an error
+ * occurs.
+ */
+int PyJType_SetKind(JNIEnv*, jclass, int);
+
+/*
+ * Get whether a class is a functional interface as stored with
+ * PyJType_SetFunctional. The result is 1 if it is, 0 if it is not and -1 if
+ * nothing is stored for the class. Returns -1 if an error occurs.
+ */
+int PyJType_GetFunctional(JNIEnv*, jclass, int*);
+
+/*
+ * Store whether a class is a functional interface so the methods of the
+ * class only need to be checked once. Returns -1 if an error occurs.
+ */
+int PyJType_SetFunctional(JNIEnv*, jclass, int);
+
+/* Visit the types in the cache, for the m_traverse of the _jep module */
+int PyJType_TraverseCache(PyJTypeCache*, visitproc, void*);
+
+/* Release all the entries in the cache, for the m_free of the _jep module */
+void PyJType_FreeCache(JNIEnv*, PyJTypeCache*);
+
 #endif // ndef pyjtype
@@ -32,13 +32,114 @@ PyObject* jchar_As_PyObject(jchar c)
     return PyUnicode_FromKindAndData(PyUnicode_2BYTE_KIND, &value, 1);
 }
 
+/* Strings up to this length are copied into a buffer on the stack. */
+#define STACK_STRING_LENGTH 256
+
+/*
+ * Create a Python str from UTF-16 characters. Strings without surrogates are
+ * created directly as the most compact str that can hold the characters,
+ * which is a single byte per character for ASCII and Latin-1.
+ */
+static PyObject* jchars_As_PyString(const jchar *chars, jsize length)
+{
+    int   surrogates = 0;
+    jsize i;
+
+    /* A simple loop so the compiler can vectorize it */
+    for (i = 0; i < length; i++) {
+        surrogates |= (chars[i] & 0xF800) == 0xD800;
+    }
+    if (surrogates) {
+        /* Explicit byte order so a leading U+FEFF is not consumed as a BOM */
+#if PY_LITTLE_ENDIAN
+        int byteorder = -1;
+#else
+        int byteorder = 1;
+#endif
+        return PyUnicode_DecodeUTF16((const char*) chars, length * 2, NULL,
+                                     &byteorder);
+    }
+    return PyUnicode_FromKindAndData(PyUnicode_2BYTE_KIND, chars, length);
+}
+
+/*
+ * Find a str with the same characters in the string cache of the interpreter
+ * or create one and place it in the cache. The cache is direct mapped so a
+ * new string replaces any string with the same slot.
+ */
+static PyObject* jchars_As_PyString_cached(JepModuleState *state,
+        const jchar *chars, jsize length)
+{
+    PyObject  **slot;
+    Py_uhash_t  hash = 2166136261U;
+    jsize       i;
+
+    if (!state->stringCache) {
+        state->stringCache = PyMem_Calloc(JEP_STRING_CACHE_SIZE,
+                                          sizeof(PyObject*));
+        if (!state->stringCache) {
+            PyErr_NoMemory();
+            return NULL;
+        }
+    }
+    for (i = 0; i < length; i++) {
+        hash = (hash ^ chars[i]) * 16777619U;
+    }
+    slot = &state->stringCache[hash & (JEP_STRING_CACHE_SIZE - 1)];
+    if (*slot && PyUnicode_GET_LENGTH(*slot) == length) {
+        int   kind = PyUnicode_KIND(*slot);
+        void *data = PyUnicode_DATA(*slot);
+        for (i = 0; i < length; i++) {
+            if (PyUnicode_READ(kind, data, i) != chars[i]) {
+                break;
+            }
+        }
+        if (i == length) {
+            Py_INCREF(*slot);
+            return *slot;
+        }
+    }
+
+    PyObject *result = jchars_As_PyString(chars, length);
+    if (result) {
+        Py_INCREF(result);
+        Py_XDECREF(*slot);
+        *slot = result;
+    }
+    return result;
+}
+
 PyObject* jstring_As_PyString(JNIEnv *env, jstring jstr)
 {
-    PyObject* result;
-    const jchar *str = (*env)->GetStringChars(env, jstr, 0);
-    jsize size = (*env)->GetStringLength(env, jstr);
-    result = PyUnicode_DecodeUTF16((const char*) str, size * 2, NULL, NULL);
-    (*env)->ReleaseStringChars(env, jstr, str);
+    JepModuleState *state;
+    jchar           stackBuffer[STACK_STRING_LENGTH];
+    jchar          *buffer = stackBuffer;
+    PyObject       *result = NULL;
+    jsize           length = (*env)->GetStringLength(env, jstr);
+
+    if (length > STACK_STRING_LENGTH) {
+        buffer = PyMem_Malloc(length * sizeof(jchar));
+        if (!buffer) {
+            return PyErr_NoMemory();
+        }
+    }
+    (*env)->GetStringRegion(env, jstr, 0, length, buffer);
+    if (process_java_exception(env)) {
+        goto EXIT;
+    }
+
+    /* Strings can be converted before or without the _jep module. */
+    state = pyembed_find_module_state();
+    if (state && state->stringCacheLength > 0
+            && length <= state->stringCacheLength) {
+        result = jchars_As_PyString_cached(state, buffer, length);
+    } else {
+        result = jchars_As_PyString(buffer, length);
+    }
+EXIT:
+    if (buffer != stackBuffer) {
+        PyMem_Free(buffer);
+    }
     return result;
 }
 
@@ -89,6 +190,40 @@ static PyObject* Character_As_PyObject(JNIEnv *env, jobject jobj)
     return jchar_As_PyObject(c);
 }
 
+/*
+ * Determine whether a type has a _to_python converter. The result is resolved
+ * once for each type and kept in the state of the _jep module until a new
+ * converter is registered. Returns 1 if there is a converter, 0 if there is
+ * not and -1 if an exception occurs.
+ */
+static int pyjtype_has_converter(PyTypeObject *type)
+{
+    JepModuleState *state = pyembed_get_module_state();
+    PyObject       *verdict;
+    int             result;
+
+    if (!state) {
+        return -1;
+    }
+    if (!state->j2pConverters) {
+        state->j2pConverters = PyDict_New();
+        if (!state->j2pConverters) {
+            return -1;
+        }
+    }
+    verdict = PyDict_GetItem(state->j2pConverters, (PyObject*) type);
+    if (verdict) {
+        return verdict == Py_True;
+    }
+    /* This only happens once for each type so the cost of the lookup is ok */
+    result = PyObject_HasAttrString((PyObject*) type, "_to_python");
+    if (PyDict_SetItem(state->j2pConverters, (PyObject*) type,
+                       result ? Py_True : Py_False)) {
+        return -1;
+    }
+    return result;
+}
+
 /*
  * This function calls user configurable conversion functions to convert a Java
  * Object into a Python equivalent. The argument must be a PyJObject and if
@@ -101,7 +236,14 @@ static PyObject* Character_As_PyObject(JNIEnv *env, jobject jobj)
 static PyObject* pyjobject_convert_pyobject(PyObject* pyjob)
 {
     PyObject* result = pyjob;
-    /* PyObject_HasAttr is not used to improve performance */
+    int hasConverter = pyjtype_has_converter(Py_TYPE(pyjob));
+    if (hasConverter <= 0) {
+        if (hasConverter < 0) {
+            Py_DECREF(pyjob);
+            return NULL;
+        }
+        return pyjob;
+    }
     PyObject* topy = PyObject_GetAttrString(pyjob, "_to_python");
     if (topy != NULL) {
         Py_DECREF(pyjob);
@@ -118,51 +260,119 @@ static PyObject* pyjobject_convert_pyobject(PyObject* pyjob)
     return result;
 }
 
-static PyObject* jnumber_As_PyObject(JNIEnv *env, jobject jobj, jclass class)
+/*
+ * The kinds of conversion stored for each class with PyJType_SetKind so the
+ * JNI checks in j2p_classify run once for each class instead of once for each
+ * object.
+ */
+#define J2P_UNKNOWN     0
+#define J2P_OBJECT      1
+#define J2P_BOOLEAN     2
+#define J2P_CHAR        3
+#define J2P_BYTE        4
+#define J2P_SHORT       5
+#define J2P_INT         6
+#define J2P_LONG        7
+#define J2P_FLOAT       8
+#define J2P_DOUBLE      9
+#define J2P_BIGINTEGER 10
+#define J2P_NUMBER     11
+#define J2P_PYOBJECT   12
+#define J2P_ARRAY      13
+#define J2P_PROXY      14
+#define J2P_CLASS      15
+
+/*
+ * Determine how to convert instances of a class. Returns J2P_UNKNOWN if an
+ * exception occurs, in which case the Python exception is set.
+ */
+static int j2p_classify(JNIEnv *env, jclass class)
+{
+    if ((*env)->IsAssignableFrom(env, class, JNUMBER_TYPE)) {
+        if ((*env)->IsSameObject(env, class, JBYTE_OBJ_TYPE)) {
+            return J2P_BYTE;
+        } else if ((*env)->IsSameObject(env, class, JSHORT_OBJ_TYPE)) {
+            return J2P_SHORT;
+        } else if ((*env)->IsSameObject(env, class, JINT_OBJ_TYPE)) {
+            return J2P_INT;
+        } else if ((*env)->IsSameObject(env, class, JLONG_OBJ_TYPE)) {
+            return J2P_LONG;
+        } else if ((*env)->IsSameObject(env, class, JDOUBLE_OBJ_TYPE)) {
+            return J2P_DOUBLE;
+        } else if ((*env)->IsSameObject(env, class, JFLOAT_OBJ_TYPE)) {
+            return J2P_FLOAT;
+        } else if ((*env)->IsSameObject(env, class, JBIGINTEGER_TYPE)) {
+            return J2P_BIGINTEGER;
+        }
+        return J2P_NUMBER;
+    } else if ((*env)->IsSameObject(env, class, JBOOL_OBJ_TYPE)) {
+        return J2P_BOOLEAN;
+    } else if ((*env)->IsSameObject(env, class, JCHAR_OBJ_TYPE)) {
+        return J2P_CHAR;
+    } else if ((*env)->IsSameObject(env, class, JCLASS_TYPE)) {
+        return J2P_CLASS;
+    } else if ((*env)->IsAssignableFrom(env, class, JPYOBJECT_TYPE)) {
+        return J2P_PYOBJECT;
+    } else {
+        jboolean array = java_lang_Class_isArray(env, class);
+        if ((*env)->ExceptionCheck(env)) {
+            process_java_exception(env);
+            return J2P_UNKNOWN;
+        } else if (array) {
+            return J2P_ARRAY;
+        } else if ((*env)->IsAssignableFrom(env, class, JAVA_PROXY_TYPE)
+                   || (*env)->IsAssignableFrom(env, class, JEP_FUNCTIONALPROXY_TYPE)) {
+            return J2P_PROXY;
+        }
+    }
+    return J2P_OBJECT;
+}
+
+static PyObject* jnumber_As_PyObject(JNIEnv *env, jobject jobj, int kind)
 {
-    if ((*env)->IsSameObject(env, class, JBYTE_OBJ_TYPE)) {
-        jbyte b = java_lang_Number_byteValue(env, jobj);
+    if (kind == J2P_BYTE) {
+        jbyte b = java_lang_Number_byteValue_boxed(env, jobj);
         if ((*env)->ExceptionCheck(env)) {
             process_java_exception(env);
             return NULL;
         }
         return jbyte_As_PyObject(b);
-    } else if ((*env)->IsSameObject(env, class, JSHORT_OBJ_TYPE)) {
-        jshort s = java_lang_Number_shortValue(env, jobj);
+    } else if (kind == J2P_SHORT) {
+        jshort s = java_lang_Number_shortValue_boxed(env, jobj);
         if ((*env)->ExceptionCheck(env)) {
             process_java_exception(env);
             return NULL;
         }
         return jshort_As_PyObject(s);
-    } else if ((*env)->IsSameObject(env, class, JINT_OBJ_TYPE)) {
-        jint i = java_lang_Number_intValue(env, jobj);
+    } else if (kind == J2P_INT) {
+        jint i = java_lang_Number_intValue_boxed(env, jobj);
         if ((*env)->ExceptionCheck(env)) {
             process_java_exception(env);
             return NULL;
         }
         return jint_As_PyObject(i);
-    } else if ((*env)->IsSameObject(env, class, JLONG_OBJ_TYPE)) {
-        jlong j = java_lang_Number_longValue(env, jobj);
+    } else if (kind == J2P_LONG) {
+        jlong j = java_lang_Number_longValue_boxed(env, jobj);
         if ((*env)->ExceptionCheck(env)) {
             process_java_exception(env);
             return NULL;
         }
         return jlong_As_PyObject(j);
-    } else if ((*env)->IsSameObject(env, class, JDOUBLE_OBJ_TYPE)) {
-        jdouble d = java_lang_Number_doubleValue(env, jobj);
+    } else if (kind == J2P_DOUBLE) {
+        jdouble d = java_lang_Number_doubleValue_boxed(env, jobj);
         if ((*env)->ExceptionCheck(env)) {
             process_java_exception(env);
             return NULL;
         }
         return jdouble_As_PyObject(d);
-    } else if ((*env)->IsSameObject(env, class, JFLOAT_OBJ_TYPE)) {
-        jfloat f = java_lang_Number_floatValue(env, jobj);
+    } else if (kind == J2P_FLOAT) {
+        jfloat f = java_lang_Number_floatValue_boxed(env, jobj);
         if ((*env)->ExceptionCheck(env)) {
             process_java_exception(env);
             return NULL;
         }
         return jfloat_As_PyObject(f);
-    } else if ((*env)->IsSameObject(env, class, JBIGINTEGER_TYPE)) {
+    } else {
         PyObject* pystr = jobject_As_PyString(env, jobj);
         if (pystr == NULL) {
             return NULL;
@@ -170,14 +380,7 @@ static PyObject* jnumber_As_PyObject(JNIEnv *env, jobject jobj, jclass class)
         PyObject* pyint = PyLong_FromUnicodeObject(pystr, 10);
         Py_DECREF(pystr);
         return pyint;
-    } else {
-        PyObject* result = jobject_As_PyJObject(env, jobj, class);
-        if (result) {
-            result = pyjobject_convert_pyobject(result);
-        }
-        return result;
     }
-
 }
 
 PyObject* jobject_As_PyJObject(JNIEnv *env, jobject jobj, jclass class)
@@ -195,57 +398,175 @@ PyObject* jobject_As_PyJObject(JNIEnv *env, jobject jobj, jclass class)
     if (!type) {
         return NULL;
     }
-    PyObject* result = PyJObject_New(env, type, jobj, class);
+    PyObject* result = PyJObject_NewCached(env, type, jobj, class);
     Py_DECREF(type);
     return result;
 }
 
 PyObject* jobject_As_PyObject(JNIEnv *env, jobject jobj)
 {
-    PyObject* result = NULL;
-    jclass    class  = NULL;
+    PyObject     *result = NULL;
+    jclass        class  = NULL;
+    int           kind   = J2P_UNKNOWN;
+    PyTypeObject *type   = NULL;
     if (jobj == NULL) {
         Py_RETURN_NONE;
     }
     class = (*env)->GetObjectClass(env, jobj);
     if ((*env)->IsSameObject(env, class, JSTRING_TYPE)) {
         result = jstring_As_PyString(env, (jstring) jobj);
-    } else if ((*env)->IsAssignableFrom(env, class, JNUMBER_TYPE)) {
-        result = jnumber_As_PyObject(env, jobj, class);
-    } else if ((*env)->IsSameObject(env, class, JBOOL_OBJ_TYPE)) {
+        (*env)->DeleteLocalRef(env, class);
+        return result;
+    }
+    if (PyJType_GetKind(env, class, &kind, &type)) {
+        goto EXIT;
+    }
+    if (kind == J2P_UNKNOWN) {
+        kind = j2p_classify(env, class);
+        if (kind == J2P_UNKNOWN || PyJType_SetKind(env, class, kind)) {
+            goto EXIT;
+        }
+    }
+
+    switch (kind) {
+    case J2P_BYTE:
+    case J2P_SHORT:
+    case J2P_INT:
+    case J2P_LONG:
+    case J2P_FLOAT:
+    case J2P_DOUBLE:
+    case J2P_BIGINTEGER:
+        result = jnumber_As_PyObject(env, jobj, kind);
+        break;
+    case J2P_BOOLEAN:
         result = Boolean_As_PyObject(env, jobj);
-    } else if ((*env)->IsSameObject(env, class, JCHAR_OBJ_TYPE)) {
+        break;
+    case J2P_CHAR:
         result = Character_As_PyObject(env, jobj);
-    } else if ((*env)->IsAssignableFrom(env, class, JPYOBJECT_TYPE)) {
+        break;
+    case J2P_PYOBJECT:
         result = JPyObject_As_PyObject(env, jobj);
-    } else {
-        jboolean array = java_lang_Class_isArray(env, class);
-        if ((*env)->ExceptionCheck(env)) {
+        break;
+    case J2P_ARRAY:
+        result = pyjarray_new(env, jobj);
+        break;
+    case J2P_CLASS:
+        result = PyJClass_Wrap(env, jobj);
+        if (result) {
+            result = pyjobject_convert_pyobject(result);
+        }
+        break;
+    case J2P_PROXY: {
+        jobject jpyObject = jep_Proxy_getPyObject(env, jobj);
+        if (jpyObject) {
+            result = JPyObject_As_PyObject(env, jpyObject);
+            break;
+        } else if ((*env)->ExceptionCheck(env)) {
             process_java_exception(env);
-        } else if (array) {
-            result = pyjarray_new(env, jobj);
+            break;
+        }
+    }
+    /* fall through, the proxy was not created by Jep */
+    default:
+        if (type) {
+            result = PyJObject_NewCached(env, type, jobj, class);
         } else {
-            int proxy_exc_occurred = 0;
-            if ((*env)->IsAssignableFrom(env, class, JAVA_PROXY_TYPE)) {
-                jobject jpyObject = jep_Proxy_getPyObject(env, jobj);
-                if (jpyObject) {
-                    result = JPyObject_As_PyObject(env, jpyObject);
-                } else if ((*env)->ExceptionCheck(env)) {
-                    proxy_exc_occurred = 1;
-                    process_java_exception(env);
-                }
-            }
-
-            if (!result && !proxy_exc_occurred) {
-                result = jobject_As_PyJObject(env, jobj, class);
-                if (result) {
-                    result = pyjobject_convert_pyobject(result);
-                }
-            }
+            result = jobject_As_PyJObject(env, jobj, class);
+        }
+        if (result) {
+            result = pyjobject_convert_pyobject(result);
         }
     }
+EXIT:
     (*env)->DeleteLocalRef(env, class);
     return result;
 }
 
+PyObject* jvalues_As_PyList(JNIEnv *env, jobject values)
+{
+    jsize     length = (*env)->GetArrayLength(env, values);
+    jsize     i;
+    PyObject *result = PyList_New(length);
+    if (!result) {
+        return NULL;
+    }
 
+    if ((*env)->IsInstanceOf(env, values, JINT_ARRAY_TYPE)) {
+        jint *ints = (*env)->GetIntArrayElements(env, values, NULL);
+        if (!ints) {
+            process_java_exception(env);
+            Py_DECREF(result);
+            return NULL;
+        }
+        for (i = 0; i < length; i++) {
+            PyObject *item = jint_As_PyObject(ints[i]);
+            if (!item) {
+                break;
+            }
+            PyList_SET_ITEM(result, i, item);
+        }
+        (*env)->ReleaseIntArrayElements(env, values, ints, JNI_ABORT);
+    } else if ((*env)->IsInstanceOf(env, values, JLONG_ARRAY_TYPE)) {
+        jlong *longs = (*env)->GetLongArrayElements(env, values, NULL);
+        if (!longs) {
+            process_java_exception(env);
+            Py_DECREF(result);
+            return NULL;
+        }
+        for (i = 0; i < length; i++) {
+            PyObject *item = jlong_As_PyObject(longs[i]);
+            if (!item) {
+                break;
+            }
+            PyList_SET_ITEM(result, i, item);
+        }
+        (*env)->ReleaseLongArrayElements(env, values, longs, JNI_ABORT);
+    } else if ((*env)->IsInstanceOf(env, values, JDOUBLE_ARRAY_TYPE)) {
+        jdouble *doubles = (*env)->GetDoubleArrayElements(env, values, NULL);
+        if (!doubles) {
+            process_java_exception(env);
+            Py_DECREF(result);
+            return NULL;
+        }
+        for (i = 0; i < length; i++) {
+            PyObject *item = jdouble_As_PyObject(doubles[i]);
+            if (!item) {
+                break;
+            }
+            PyList_SET_ITEM(result, i, item);
+        }
+        (*env)->ReleaseDoubleArrayElements(env, values, doubles, JNI_ABORT);
+    } else if ((*env)->IsInstanceOf(env, values, JBOOLEAN_ARRAY_TYPE)) {
+        jboolean *booleans = (*env)->GetBooleanArrayElements(env, values, NULL);
+        if (!booleans) {
+            process_java_exception(env);
+            Py_DECREF(result);
+            return NULL;
+        }
+        for (i = 0; i < length; i++) {
+            PyList_SET_ITEM(result, i, jboolean_As_PyObject(booleans[i]));
+        }
+        (*env)->ReleaseBooleanArrayElements(env, values, booleans, JNI_ABORT);
+    } else {
+        for (i = 0; i < length; i++) {
+            jobject   value = (*env)->GetObjectArrayElement(env, values, i);
+            PyObject *item;
+            if (process_java_exception(env)) {
+                break;
+            }
+            item = jobject_As_PyObject(env, value);
+            (*env)->DeleteLocalRef(env, value);
+            if (!item) {
+                break;
+            }
+            PyList_SET_ITEM(result, i, item);
+        }
+    }
+
+    if (i < length) {
+        /* The remaining items are NULL which is safe for list dealloc */
+        Py_DECREF(result);
+        return NULL;
+    }
+    return result;
+}
@@ -199,10 +199,9 @@ static jchar pyunicode_as_jchar(PyObject *pyunicode)
         if (PyUnicode_READY(pyunicode) != 0) {
             return 0;
         } else if (PyUnicode_GET_LENGTH(pyunicode) == 1) {
-            if (PyUnicode_KIND((pyunicode)) == PyUnicode_1BYTE_KIND) {
-                return (jchar) PyUnicode_1BYTE_DATA(pyunicode)[0];
-            } else if (PyUnicode_KIND((pyunicode)) == PyUnicode_2BYTE_KIND) {
-                return (jchar) PyUnicode_2BYTE_DATA(pyunicode)[0];
+            Py_UCS4 c = PyUnicode_READ_CHAR(pyunicode, 0);
+            if (c <= 0xFFFF) {
+                return (jchar) c;
             }
         }
     }
@@ -211,26 +210,96 @@ static jchar pyunicode_as_jchar(PyObject *pyunicode)
     return 0;
 }
 
+/* Strings up to this length are widened in a buffer on the stack. */
+#define STACK_STRING_LENGTH 256
+
+/*
+ * Widen Latin-1 characters to UTF-16. This is a simple loop so the compiler
+ * can vectorize it.
+ */
+static void latin1_as_jchars(const Py_UCS1 *data, Py_ssize_t length,
+                             jchar *buffer)
+{
+    Py_ssize_t i;
+    for (i = 0; i < length; i++) {
+        buffer[i] = (jchar) data[i];
+    }
+}
+
+/*
+ * Encode UCS-4 characters to UTF-16, the buffer must have room for a surrogate
+ * pair for every character above the basic multilingual plane.
+ */
+static void ucs4_as_jchars(const Py_UCS4 *data, Py_ssize_t length,
+                           jchar *buffer)
+{
+    Py_ssize_t i;
+    for (i = 0; i < length; i++) {
+        Py_UCS4 c = data[i];
+        if (c > 0xFFFF) {
+            c -= 0x10000;
+            *buffer++ = (jchar) (0xD800 | (c >> 10));
+            *buffer++ = (jchar) (0xDC00 | (c & 0x3FF));
+        } else {
+            *buffer++ = (jchar) c;
+        }
+    }
+}
 
 static jstring pyunicode_as_jstring(JNIEnv *env, PyObject *pyunicode)
 {
-    PyObject* bytes = NULL;
-    jstring result  = NULL;
+    jchar       stackBuffer[STACK_STRING_LENGTH];
+    jchar      *buffer  = stackBuffer;
+    jstring     result  = NULL;
+    Py_ssize_t  length;
+    Py_ssize_t  jlength;
+    int         kind;
+
     if (PyUnicode_READY(pyunicode) != 0) {
         return NULL;
-    } else if (PyUnicode_KIND((pyunicode)) == PyUnicode_2BYTE_KIND) {
+    }
+    kind   = PyUnicode_KIND(pyunicode);
+    length = PyUnicode_GET_LENGTH(pyunicode);
+    if (kind == PyUnicode_2BYTE_KIND) {
         Py_UCS2* data = PyUnicode_2BYTE_DATA(pyunicode);
-        Py_ssize_t length = PyUnicode_GET_LENGTH(pyunicode);
         return (*env)->NewString(env, (jchar*) data, (jsize) length);
+    } else if (PyUnicode_IS_ASCII(pyunicode)) {
+        /*
+         * ASCII is valid modified UTF-8 except for NUL, which modified UTF-8
+         * encodes with two bytes. The data is always NUL terminated.
+         */
+        const char *data = (const char*) PyUnicode_1BYTE_DATA(pyunicode);
+        if (!memchr(data, 0, length)) {
+            return (*env)->NewStringUTF(env, data);
+        }
     }
-    bytes = PyUnicode_AsUTF16String(pyunicode);
-    if (bytes == NULL) {
-        return NULL;
+
+    jlength = length;
+    if (kind == PyUnicode_4BYTE_KIND) {
+        Py_UCS4   *data = PyUnicode_4BYTE_DATA(pyunicode);
+        Py_ssize_t i;
+        for (i = 0; i < length; i++) {
+            if (data[i] > 0xFFFF) {
+                jlength += 1;
+            }
+        }
+    }
+    if (jlength > STACK_STRING_LENGTH) {
+        buffer = PyMem_Malloc(jlength * sizeof(jchar));
+        if (!buffer) {
+            PyErr_NoMemory();
+            return NULL;
+        }
+    }
+    if (kind == PyUnicode_1BYTE_KIND) {
+        latin1_as_jchars(PyUnicode_1BYTE_DATA(pyunicode), length, buffer);
+    } else {
+        ucs4_as_jchars(PyUnicode_4BYTE_DATA(pyunicode), length, buffer);
+    }
+    result = (*env)->NewString(env, buffer, (jsize) jlength);
+    if (buffer != stackBuffer) {
+        PyMem_Free(buffer);
     }
-    /* +2 is to strip the BOM */
-    result = (*env)->NewString(env, (jchar*) (PyBytes_AS_STRING(bytes) + 2),
-                               (jsize) (PyBytes_GET_SIZE(bytes) - 2) / 2);
-    Py_DECREF(bytes);
     return result;
 }
 
@@ -253,6 +322,22 @@ jstring PyObject_As_jstring(JNIEnv *env, PyObject *pyobject)
     return result;
 }
 
+/*
+ * Returns a new local reference to the canonical box of a small integer from
+ * one of the caches set up by cache_boxed_values(), or NULL without an
+ * exception if the value is not cached and a box must be created.
+ */
+static jobject cached_box(JNIEnv *env, jobject *cache, jlong value)
+{
+    if (value >= JBOX_CACHE_LOW && value <= JBOX_CACHE_HIGH) {
+        jobject box = cache[value - JBOX_CACHE_LOW];
+        if (box) {
+            return (*env)->NewLocalRef(env, box);
+        }
+    }
+    return NULL;
+}
+
 static jobject pybool_as_jobject(JNIEnv *env, PyObject *pyobject,
                                  jclass expectedType)
 {
@@ -262,6 +347,12 @@ static jobject pybool_as_jobject(JNIEnv *env, PyObject *pyobject,
         if (PyErr_Occurred()) {
             return NULL;
         }
+        if (JBOOLEAN_TRUE) {
+            result = (*env)->NewLocalRef(env, z ? JBOOLEAN_TRUE : JBOOLEAN_FALSE);
+            if (result) {
+                return result;
+            }
+        }
         result = java_lang_Boolean_new_Z(env, z);
         if (!result) {
             process_java_exception(env);
@@ -328,6 +419,10 @@ static jobject pylong_as_jobject(JNIEnv *env, PyObject *pyobject,
             }
             return NULL;
         }
+        result = cached_box(env, JLONG_CACHE, j);
+        if (result) {
+            return result;
+        }
         result = java_lang_Long_new_J(env, j);
         if (!result) {
             process_java_exception(env);
@@ -340,6 +435,10 @@ static jobject pylong_as_jobject(JNIEnv *env, PyObject *pyobject,
         if (i == -1 && PyErr_Occurred()) {
             return NULL;
         }
+        result = cached_box(env, JINTEGER_CACHE, i);
+        if (result) {
+            return result;
+        }
         result = java_lang_Integer_new_I(env, i);
         if (!result) {
             process_java_exception(env);
@@ -444,33 +543,86 @@ static jobject pyfloat_as_jobject(JNIEnv *env, PyObject *pyobject,
     return (*env)->PopLocalFrame(env, jarray);
 
 /* Convert a list or tuple to an ArrayList */
-static jobject pyfastsequence_as_jobject(JNIEnv *env, PyObject *pyseq,
-        jclass expectedType)
+/*
+ * Convert a list or tuple to a java.util.ArrayList, or an unmodifiable List
+ * for a tuple. The values are converted into a single array that is passed to
+ * Java in one call instead of calling List.add() for every value. Sequences
+ * containing only int or only float values are copied into a long[] or
+ * double[] and boxed on the Java side.
+ */
+static jobject pyfastsequence_as_jlist(JNIEnv *env, PyObject *pyseq)
 {
-    jboolean isArray;
-    if ((*env)->IsAssignableFrom(env, JLIST_TYPE, expectedType)
-            || (PyList_Check(pyseq)
-                && (*env)->IsAssignableFrom(env, JARRAYLIST_TYPE, expectedType))) {
-        jobject jlist;
-        Py_ssize_t size, i;
+    jobject    values   = NULL;
+    jobject    jlist    = NULL;
+    Py_ssize_t size     = PySequence_Fast_GET_SIZE(pyseq);
+    PyObject **items    = PySequence_Fast_ITEMS(pyseq);
+    int        allLong  = size > 0;
+    int        allFloat = size > 0;
+    Py_ssize_t i;
+
+    for (i = 0; i < size && (allLong || allFloat); i++) {
+        allLong  = allLong && PyLong_CheckExact(items[i]);
+        allFloat = allFloat && PyFloat_CheckExact(items[i]);
+    }
 
-        size = PySequence_Fast_GET_SIZE(pyseq);
+    if ((*env)->PushLocalFrame(env, JLOCAL_REFS) != 0) {
+        process_java_exception(env);
+        return NULL;
+    }
 
-        if ((*env)->PushLocalFrame(env, JLOCAL_REFS) != 0) {
+    if (allLong) {
+        jlong *longs;
+        values = (*env)->NewLongArray(env, (jsize) size);
+        if (!values) {
             process_java_exception(env);
-            return NULL;
+            return (*env)->PopLocalFrame(env, NULL);
         }
-
-        jlist = java_util_ArrayList_new_I(env, (jint) size);
-        if (!jlist) {
+        longs = (*env)->GetLongArrayElements(env, values, NULL);
+        if (!longs) {
             process_java_exception(env);
             return (*env)->PopLocalFrame(env, NULL);
         }
+        for (i = 0; i < size; i++) {
+            longs[i] = PyObject_As_jlong(items[i]);
+            if (longs[i] == -1 && PyErr_Occurred()) {
+                break;
+            }
+        }
+        (*env)->ReleaseLongArrayElements(env, values, longs, 0);
+        if (i < size) {
+            if (!PyErr_ExceptionMatches(PyExc_OverflowError)) {
+                return (*env)->PopLocalFrame(env, NULL);
+            }
+            /* Too big for a Long, let the general path create a BigInteger */
+            PyErr_Clear();
+            values = NULL;
+        }
+    } else if (allFloat) {
+        jdouble *doubles;
+        values = (*env)->NewDoubleArray(env, (jsize) size);
+        if (!values) {
+            process_java_exception(env);
+            return (*env)->PopLocalFrame(env, NULL);
+        }
+        doubles = (*env)->GetDoubleArrayElements(env, values, NULL);
+        if (!doubles) {
+            process_java_exception(env);
+            return (*env)->PopLocalFrame(env, NULL);
+        }
+        for (i = 0; i < size; i++) {
+            doubles[i] = PyFloat_AS_DOUBLE(items[i]);
+        }
+        (*env)->ReleaseDoubleArrayElements(env, values, doubles, 0);
+    }
 
+    if (!values) {
+        values = (*env)->NewObjectArray(env, (jsize) size, JOBJECT_TYPE, NULL);
+        if (!values) {
+            process_java_exception(env);
+            return (*env)->PopLocalFrame(env, NULL);
+        }
         for (i = 0; i < size; i++) {
-            jobject value;
-            PyObject *item = PySequence_Fast_GET_ITEM(pyseq, i);
-            value = PyObject_As_jobject(env, item, JOBJECT_TYPE);
+            jobject value = PyObject_As_jobject(env, items[i], JOBJECT_TYPE);
             if (value == NULL && PyErr_Occurred()) {
                 /*
                  * java exceptions will have been transformed to python
@@ -478,20 +630,26 @@ static jobject pyfastsequence_as_jobject(JNIEnv *env, PyObject *pyseq,
                  */
                 return (*env)->PopLocalFrame(env, NULL);
             }
-            java_util_List_add(env, jlist, value);
+            (*env)->SetObjectArrayElement(env, values, (jsize) i, value);
             (*env)->DeleteLocalRef(env, value);
-            if (process_java_exception(env)) {
-                return (*env)->PopLocalFrame(env, NULL);
-            }
         }
+    }
 
-        if (PyTuple_Check(pyseq)) {
-            jlist = java_util_Collections_unmodifiableList(env, jlist);
-            if (process_java_exception(env)) {
-                return (*env)->PopLocalFrame(env, NULL);
-            }
-        }
-        return (*env)->PopLocalFrame(env, jlist);
+    jlist = jep_BulkConverter_toList_Object_Z(env, values, PyTuple_Check(pyseq));
+    if (process_java_exception(env)) {
+        return (*env)->PopLocalFrame(env, NULL);
+    }
+    return (*env)->PopLocalFrame(env, jlist);
+}
+
+static jobject pyfastsequence_as_jobject(JNIEnv *env, PyObject *pyseq,
+        jclass expectedType)
+{
+    jboolean isArray;
+    if ((*env)->IsAssignableFrom(env, JLIST_TYPE, expectedType)
+            || (PyList_Check(pyseq)
+                && (*env)->IsAssignableFrom(env, JARRAYLIST_TYPE, expectedType))) {
+        return pyfastsequence_as_jlist(env, pyseq);
     }
     isArray = java_lang_Class_isArray(env, expectedType);
     if (process_java_exception(env)) {
@@ -565,47 +723,65 @@ static jobject pydict_as_jobject(JNIEnv *env, PyObject *pydict,
                                  jclass expectedType)
 {
     if ((*env)->IsAssignableFrom(env, JHASHMAP_TYPE, expectedType)) {
-        jobject jmap;
-        Py_ssize_t size, pos;
-        PyObject *key, *value;
+        jobjectArray jkeys, jvalues;
+        jobject      jmap;
+        Py_ssize_t   size, pos, i;
+        PyObject    *key, *value;
 
         size = PyDict_Size(pydict);
-        /* Account for default load factor */
-        size = (Py_ssize_t) ((size / 0.75) + 1);
 
         if ((*env)->PushLocalFrame(env, JLOCAL_REFS) != 0) {
             process_java_exception(env);
             return NULL;
         }
 
-        jmap = java_util_HashMap_new_I(env, (jint) size);
-        if (!jmap) {
+        /*
+         * The entries are converted into parallel arrays so the map can be
+         * built with a single call instead of calling put() for each entry.
+         */
+        jkeys = (*env)->NewObjectArray(env, (jsize) size, JOBJECT_TYPE, NULL);
+        if (!jkeys) {
             process_java_exception(env);
-            (*env)->PopLocalFrame(env, NULL);
-            return NULL;
+            return (*env)->PopLocalFrame(env, NULL);
+        }
+        jvalues = (*env)->NewObjectArray(env, (jsize) size, JOBJECT_TYPE, NULL);
+        if (!jvalues) {
+            process_java_exception(env);
+            return (*env)->PopLocalFrame(env, NULL);
         }
 
         pos = 0;
+        i = 0;
         while (PyDict_Next(pydict, &pos, &key, &value)) {
             jobject jkey, jvalue;
+            if (i >= size) {
+                PyErr_SetString(PyExc_RuntimeError,
+                                "dictionary changed size during conversion");
+                return (*env)->PopLocalFrame(env, NULL);
+            }
             jkey = PyObject_As_jobject(env, key, JOBJECT_TYPE);
             if (jkey == NULL && PyErr_Occurred()) {
-                (*env)->PopLocalFrame(env, NULL);
-                return NULL;
+                return (*env)->PopLocalFrame(env, NULL);
             }
+            (*env)->SetObjectArrayElement(env, jkeys, (jsize) i, jkey);
+            (*env)->DeleteLocalRef(env, jkey);
             jvalue = PyObject_As_jobject(env, value, JOBJECT_TYPE);
             if (jvalue == NULL && PyErr_Occurred()) {
-                (*env)->PopLocalFrame(env, NULL);
-                return NULL;
+                return (*env)->PopLocalFrame(env, NULL);
             }
-
-            java_util_Map_put(env, jmap, jkey, jvalue);
-            (*env)->DeleteLocalRef(env, jkey);
+            (*env)->SetObjectArrayElement(env, jvalues, (jsize) i, jvalue);
             (*env)->DeleteLocalRef(env, jvalue);
-            if (process_java_exception(env)) {
-                (*env)->PopLocalFrame(env, NULL);
-                return NULL;
-            }
+            i++;
+        }
+        if (i != size) {
+            PyErr_SetString(PyExc_RuntimeError,
+                            "dictionary changed size during conversion");
+            return (*env)->PopLocalFrame(env, NULL);
+        }
+
+        jmap = jep_BulkConverter_toHashMap(env, jkeys, jvalues);
+        if (process_java_exception(env)) {
+            return (*env)->PopLocalFrame(env, NULL);
         }
         return (*env)->PopLocalFrame(env, jmap);
     } else if ((*env)->IsAssignableFrom(env, JPYOBJECT_TYPE, expectedType)) {
@@ -615,7 +791,48 @@ static jobject pydict_as_jobject(JNIEnv *env, PyObject *pydict,
     return NULL;
 }
 
-char isFunctionalInterfaceType(JNIEnv *env, jclass type)
+/*
+ * Check if an abstract method of an interface is a public method of
+ * java.lang.Object, like equals() in java.util.Comparator. Every
+ * implementation inherits these methods so they do not count against the
+ * single abstract method of a functional interface.
+ */
+static int isObjectMethod(JNIEnv *env, jobject method)
+{
+    jstring      name;
+    jobjectArray paramTypes;
+    const char  *cname;
+    jsize        numParams;
+    int          result = 0;
+
+    name = java_lang_reflect_Member_getName(env, method);
+    if (!name) {
+        return 0;
+    }
+    paramTypes = java_lang_reflect_Executable_getParameterTypes(env, method);
+    if (!paramTypes) {
+        return 0;
+    }
+    numParams = (*env)->GetArrayLength(env, paramTypes);
+    cname = (*env)->GetStringUTFChars(env, name, 0);
+    if (numParams == 0) {
+        result = strcmp(cname, "hashCode") == 0 || strcmp(cname, "toString") == 0;
+    } else if (numParams == 1 && strcmp(cname, "equals") == 0) {
+        jobject paramType = (*env)->GetObjectArrayElement(env, paramTypes, 0);
+        result = (*env)->IsSameObject(env, paramType, JOBJECT_TYPE);
+        (*env)->DeleteLocalRef(env, paramType);
+    }
+    (*env)->ReleaseStringUTFChars(env, name, cname);
+    (*env)->DeleteLocalRef(env, paramTypes);
+    (*env)->DeleteLocalRef(env, name);
+    return result;
+}
+
+/*
+ * Check the methods of a class to determine if it is an interface with
+ * exactly one abstract method.
+ */
+static char checkFunctionalInterface(JNIEnv *env, jclass type)
 {
     jobjectArray methods;
     jsize numMethods;
@@ -632,6 +849,7 @@ char isFunctionalInterfaceType(JNIEnv *env, jclass type)
         return 0;
     }
     if (!isInterface) {
+        (*env)->PopLocalFrame(env, NULL);
         return 0; // It's not an interface, so it can't be functional
     }
     methods = java_lang_Class_getMethods(env, type);
@@ -653,7 +871,12 @@ char isFunctionalInterfaceType(JNIEnv *env, jclass type)
             (*env)->PopLocalFrame(env, NULL);
             return 0;
         }
-        if (isAbstract) {
+        if (isAbstract && isObjectMethod(env, method)) {
+            (*env)->DeleteLocalRef(env, method);
+        } else if (process_java_exception(env)) {
+            (*env)->PopLocalFrame(env, NULL);
+            return 0;
+        } else if (isAbstract) {
             if (abstractMethod != NULL) {
                 // We found two different abstract methods, so we're not a functional interfaces
                 (*env)->PopLocalFrame(env, NULL);
@@ -670,6 +893,27 @@ char isFunctionalInterfaceType(JNIEnv *env, jclass type)
     return abstractMethod != NULL;
 }
 
+/*
+ * Check if a class is a functional interface. The result is stored in the
+ * type cache because callables are often passed for the same interface many
+ * times and checking the methods requires reflection.
+ */
+char isFunctionalInterfaceType(JNIEnv *env, jclass type)
+{
+    int functional;
+
+    if (PyJType_GetFunctional(env, type, &functional)) {
+        return 0;
+    }
+    if (functional < 0) {
+        functional = checkFunctionalInterface(env, type);
+        if (PyErr_Occurred() || PyJType_SetFunctional(env, type, functional)) {
+            return 0;
+        }
+    }
+    return (char) functional;
+}
+
 jobject PyCallable_as_functional_interface(JNIEnv *env, PyObject *callable,
         jclass expectedType)
 {
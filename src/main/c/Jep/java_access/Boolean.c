@@ -29,6 +29,7 @@
 
 static jmethodID init_Z       = 0;
 static jmethodID booleanValue = 0;
+static jmethodID valueOf      = 0;
 
 jobject java_lang_Boolean_new_Z(JNIEnv* env, jboolean z)
 {
@@ -38,13 +39,22 @@ jobject java_lang_Boolean_new_Z(JNIEnv* env, jboolean z)
     return (*env)->NewObject(env, JBOOL_OBJ_TYPE, init_Z, z);
 }
 
+jobject java_lang_Boolean_valueOf(JNIEnv* env, jboolean z)
+{
+    jobject result = NULL;
+    if (valueOf
+            || (valueOf = (*env)->GetStaticMethodID(env, JBOOL_OBJ_TYPE, "valueOf",
+                          "(Z)Ljava/lang/Boolean;"))) {
+        result = (*env)->CallStaticObjectMethod(env, JBOOL_OBJ_TYPE, valueOf, z);
+    }
+    return result;
+}
+
 jboolean java_lang_Boolean_booleanValue(JNIEnv* env, jobject this)
 {
     jboolean result = JNI_FALSE;
-    Py_BEGIN_ALLOW_THREADS
     if (JNI_METHOD(booleanValue, env, JBOOL_OBJ_TYPE, "booleanValue", "()Z")) {
         result = (*env)->CallBooleanMethod(env, this, booleanValue);
     }
-    Py_END_ALLOW_THREADS
     return result;
 }
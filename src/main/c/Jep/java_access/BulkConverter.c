@@ -0,0 +1,93 @@
+/*
+   jep - Java Embedded Python
+
+   Copyright (c) 2024 JEP AUTHORS.
+
+   This file is licensed under the the zlib/libpng License.
+
+   This software is provided 'as-is', without any express or implied
+   warranty. In no event will the authors be held liable for any
+   damages arising from the use of this software.
+
+   Permission is granted to anyone to use this software for any
+   purpose, including commercial applications, and to alter it and
+   redistribute it freely, subject to the following restrictions:
+
+   1. The origin of this software must not be misrepresented; you
+   must not claim that you wrote the original software. If you use
+   this software in a product, an acknowledgment in the product
+   documentation would be appreciated but is not required.
+
+   2. Altered source versions must be plainly marked as such, and
+   must not be misrepresented as being the original software.
+
+   3. This notice may not be removed or altered from any source
+   distribution.
+*/
+
+#include "Jep.h"
+
+static jmethodID toArray_List_I_I = 0;
+static jmethodID toList_Object_Z  = 0;
+static jmethodID toHashMap        = 0;
+static jmethodID next_Iterator_I_Throwable = 0;
+
+jobject jep_BulkConverter_toArray_List_I_I(JNIEnv* env, jobject list,
+        jint fromIndex, jint toIndex)
+{
+    jobject result = NULL;
+    Py_BEGIN_ALLOW_THREADS
+    if (toArray_List_I_I
+            || (toArray_List_I_I = (*env)->GetStaticMethodID(env, JEP_BULKCONVERTER_TYPE,
+                                   "toArray", "(Ljava/util/List;II)Ljava/lang/Object;"))) {
+        result = (*env)->CallStaticObjectMethod(env, JEP_BULKCONVERTER_TYPE,
+                                                toArray_List_I_I, list, fromIndex, toIndex);
+    }
+    Py_END_ALLOW_THREADS
+    return result;
+}
+
+jobject jep_BulkConverter_toList_Object_Z(JNIEnv* env, jobject values,
+        jboolean unmodifiable)
+{
+    jobject result = NULL;
+    Py_BEGIN_ALLOW_THREADS
+    if (toList_Object_Z
+            || (toList_Object_Z = (*env)->GetStaticMethodID(env, JEP_BULKCONVERTER_TYPE,
+                                  "toList", "(Ljava/lang/Object;Z)Ljava/util/List;"))) {
+        result = (*env)->CallStaticObjectMethod(env, JEP_BULKCONVERTER_TYPE,
+                                                toList_Object_Z, values, unmodifiable);
+    }
+    Py_END_ALLOW_THREADS
+    return result;
+}
+
+jobject jep_BulkConverter_toHashMap(JNIEnv* env, jobjectArray keys,
+                                    jobjectArray values)
+{
+    jobject result = NULL;
+    Py_BEGIN_ALLOW_THREADS
+    if (toHashMap
+            || (toHashMap = (*env)->GetStaticMethodID(env, JEP_BULKCONVERTER_TYPE,
+                            "toHashMap", "([Ljava/lang/Object;[Ljava/lang/Object;)Ljava/util/HashMap;"))) {
+        result = (*env)->CallStaticObjectMethod(env, JEP_BULKCONVERTER_TYPE,
+                                                toHashMap, keys, values);
+    }
+    Py_END_ALLOW_THREADS
+    return result;
+}
+
+jobject jep_BulkConverter_next_Iterator_I_Throwable(JNIEnv* env,
+        jobject iterator, jint max, jobjectArray failure)
+{
+    jobject result = NULL;
+    Py_BEGIN_ALLOW_THREADS
+    if (next_Iterator_I_Throwable
+            || (next_Iterator_I_Throwable = (*env)->GetStaticMethodID(env, JEP_BULKCONVERTER_TYPE,
+                                  "next", "(Ljava/util/Iterator;I[Ljava/lang/Throwable;)Ljava/lang/Object;"))) {
+        result = (*env)->CallStaticObjectMethod(env, JEP_BULKCONVERTER_TYPE,
+                                                next_Iterator_I_Throwable, iterator, max, failure);
+    }
+    Py_END_ALLOW_THREADS
+    return result;
+}
@@ -42,10 +42,8 @@ jobject java_lang_Character_new_C(JNIEnv* env, jchar c)
 jchar java_lang_Character_charValue(JNIEnv* env, jobject this)
 {
     jchar result = 0;
-    Py_BEGIN_ALLOW_THREADS
     if (JNI_METHOD(charValue, env, JCHAR_OBJ_TYPE, "charValue", "()C")) {
         result = (*env)->CallCharMethod(env, this, charValue);
     }
-    Py_END_ALLOW_THREADS
     return result;
 }
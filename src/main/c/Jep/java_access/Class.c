@@ -46,12 +46,10 @@ static jmethodID getSuperclass      = 0;
 jclass java_lang_Class_getComponentType(JNIEnv* env, jclass this)
 {
     jclass result = NULL;
-    Py_BEGIN_ALLOW_THREADS
     if (JNI_METHOD(getComponentType, env, JCLASS_TYPE, "getComponentType",
                    "()Ljava/lang/Class;")) {
         result = (jclass) (*env)->CallObjectMethod(env, this, getComponentType);
     }
-    Py_END_ALLOW_THREADS
     return result;
 }
 
@@ -130,22 +128,18 @@ jobjectArray java_lang_Class_getMethods(JNIEnv* env, jclass this)
 jint java_lang_Class_getModifiers(JNIEnv* env, jclass this)
 {
     jint result = 0;
-    Py_BEGIN_ALLOW_THREADS
     if (JNI_METHOD(getModifiers, env, JCLASS_TYPE, "getModifiers", "()I")) {
         result = (*env)->CallIntMethod(env, this, getModifiers);
     }
-    Py_END_ALLOW_THREADS
     return result;
 }
 
 jstring java_lang_Class_getName(JNIEnv* env, jclass this)
 {
     jstring result = NULL;
-    Py_BEGIN_ALLOW_THREADS
     if (JNI_METHOD(getName, env, JCLASS_TYPE, "getName", "()Ljava/lang/String;")) {
         result = (jstring) (*env)->CallObjectMethod(env, this, getName);
     }
-    Py_END_ALLOW_THREADS
     return result;
 }
 
@@ -164,11 +158,9 @@ jstring java_lang_Class_getSimpleName(JNIEnv* env, jclass this)
 jboolean java_lang_Class_isArray(JNIEnv* env, jclass this)
 {
     jboolean result = JNI_FALSE;
-    Py_BEGIN_ALLOW_THREADS
     if (JNI_METHOD(isArray, env, JCLASS_TYPE, "isArray", "()Z")) {
         result = (*env)->CallBooleanMethod(env, this, isArray);
     }
-    Py_END_ALLOW_THREADS
     return result;
 }
 
@@ -187,34 +179,28 @@ jobject java_lang_Class_newInstance(JNIEnv* env, jclass this)
 jboolean java_lang_Class_isInterface(JNIEnv* env, jclass this)
 {
     jboolean result = JNI_FALSE;
-    Py_BEGIN_ALLOW_THREADS
     if (JNI_METHOD(isInterface, env, JCLASS_TYPE, "isInterface", "()Z")) {
         result = (*env)->CallBooleanMethod(env, this, isInterface);
     }
-    Py_END_ALLOW_THREADS
     return result;
 }
 
 jclass java_lang_Class_getSuperclass(JNIEnv* env, jclass this)
 {
     jclass result = NULL;
-    Py_BEGIN_ALLOW_THREADS
     if (JNI_METHOD(getSuperclass, env, JCLASS_TYPE, "getSuperclass",
                    "()Ljava/lang/Class;")) {
         result = (jclass) (*env)->CallObjectMethod(env, this, getSuperclass);
     }
-    Py_END_ALLOW_THREADS
     return result;
 }
 
 jobjectArray java_lang_Class_getInterfaces(JNIEnv* env, jclass this)
 {
     jobjectArray result = NULL;
-    Py_BEGIN_ALLOW_THREADS
     if (JNI_METHOD(getInterfaces, env, JCLASS_TYPE, "getInterfaces",
                    "()[Ljava/lang/Class;")) {
         result = (jobjectArray) (*env)->CallObjectMethod(env, this, getInterfaces);
     }
-    Py_END_ALLOW_THREADS
     return result;
 }
@@ -27,7 +27,8 @@
 
 #include "Jep.h"
 
-static jmethodID init_I = 0;
+static jmethodID init_I  = 0;
+static jmethodID valueOf = 0;
 
 jobject java_lang_Integer_new_I(JNIEnv* env, jint i)
 {
@@ -36,3 +37,14 @@ jobject java_lang_Integer_new_I(JNIEnv* env, jint i)
     }
     return (*env)->NewObject(env, JINT_OBJ_TYPE, init_I, i);
 }
+
+jobject java_lang_Integer_valueOf(JNIEnv* env, jint i)
+{
+    jobject result = NULL;
+    if (valueOf
+            || (valueOf = (*env)->GetStaticMethodID(env, JINT_OBJ_TYPE, "valueOf",
+                          "(I)Ljava/lang/Integer;"))) {
+        result = (*env)->CallStaticObjectMethod(env, JINT_OBJ_TYPE, valueOf, i);
+    }
+    return result;
+}
@@ -29,6 +29,7 @@
 
 static jmethodID varargs = 0;
 static jmethodID kwargs  = 0;
+static jmethodID releaseGIL = 0;
 
 
 jboolean jep_PyMethod_varargs(JNIEnv* env, jobject this)
@@ -48,3 +49,12 @@ jboolean jep_PyMethod_kwargs(JNIEnv* env, jobject this)
     }
     return result;
 }
+
+jboolean jep_PyMethod_releaseGIL(JNIEnv* env, jobject this)
+{
+    jboolean result = JNI_TRUE;
+    if (JNI_METHOD(releaseGIL, env, JPYMETHOD_TYPE, "releaseGIL", "()Z")) {
+        result = (*env)->CallBooleanMethod(env, this, releaseGIL);
+    }
+    return result;
+}
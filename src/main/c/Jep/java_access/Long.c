@@ -27,7 +27,8 @@
 
 #include "Jep.h"
 
-static jmethodID init_J = 0;
+static jmethodID init_J  = 0;
+static jmethodID valueOf = 0;
 
 jobject java_lang_Long_new_J(JNIEnv* env, jlong j)
 {
@@ -36,3 +37,14 @@ jobject java_lang_Long_new_J(JNIEnv* env, jlong j)
     }
     return (*env)->NewObject(env, JLONG_OBJ_TYPE, init_J, j);
 }
+
+jobject java_lang_Long_valueOf(JNIEnv* env, jlong j)
+{
+    jobject result = NULL;
+    if (valueOf
+            || (valueOf = (*env)->GetStaticMethodID(env, JLONG_OBJ_TYPE, "valueOf",
+                          "(J)Ljava/lang/Long;"))) {
+        result = (*env)->CallStaticObjectMethod(env, JLONG_OBJ_TYPE, valueOf, j);
+    }
+    return result;
+}
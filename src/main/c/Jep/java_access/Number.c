@@ -34,6 +34,12 @@ static jmethodID intValue    = 0;
 static jmethodID longValue   = 0;
 static jmethodID shortValue = 0;
 
+/*
+ * A Number subclass can run any code in its value methods so the GIL is
+ * released. The classes of boxed primitives are final and their value methods
+ * only read a field, so callers that already know the object is a boxed
+ * primitive use the _boxed functions, which keep the GIL.
+ */
 jbyte java_lang_Number_byteValue(JNIEnv* env, jobject this)
 {
     jbyte result = 0;
@@ -45,6 +51,15 @@ jbyte java_lang_Number_byteValue(JNIEnv* env, jobject this)
     return result;
 }
 
+jbyte java_lang_Number_byteValue_boxed(JNIEnv* env, jobject this)
+{
+    jbyte result = 0;
+    if (JNI_METHOD(byteValue, env, JNUMBER_TYPE, "byteValue", "()B")) {
+        result = (*env)->CallByteMethod(env, this, byteValue);
+    }
+    return result;
+}
+
 jdouble java_lang_Number_doubleValue(JNIEnv* env, jobject this)
 {
     jdouble result = 0;
@@ -56,6 +71,15 @@ jdouble java_lang_Number_doubleValue(JNIEnv* env, jobject this)
     return result;
 }
 
+jdouble java_lang_Number_doubleValue_boxed(JNIEnv* env, jobject this)
+{
+    jdouble result = 0;
+    if (JNI_METHOD(doubleValue, env, JNUMBER_TYPE, "doubleValue", "()D")) {
+        result = (*env)->CallDoubleMethod(env, this, doubleValue);
+    }
+    return result;
+}
+
 jfloat java_lang_Number_floatValue(JNIEnv* env, jobject this)
 {
     jfloat result = 0;
@@ -67,6 +91,15 @@ jfloat java_lang_Number_floatValue(JNIEnv* env, jobject this)
     return result;
 }
 
+jfloat java_lang_Number_floatValue_boxed(JNIEnv* env, jobject this)
+{
+    jfloat result = 0;
+    if (JNI_METHOD(floatValue, env, JNUMBER_TYPE, "floatValue", "()F")) {
+        result = (*env)->CallFloatMethod(env, this, floatValue);
+    }
+    return result;
+}
+
 jint java_lang_Number_intValue(JNIEnv* env, jobject this)
 {
     jint result = 0;
@@ -78,6 +111,15 @@ jint java_lang_Number_intValue(JNIEnv* env, jobject this)
     return result;
 }
 
+jint java_lang_Number_intValue_boxed(JNIEnv* env, jobject this)
+{
+    jint result = 0;
+    if (JNI_METHOD(intValue, env, JNUMBER_TYPE, "intValue", "()I")) {
+        result = (*env)->CallIntMethod(env, this, intValue);
+    }
+    return result;
+}
+
 jlong java_lang_Number_longValue(JNIEnv* env, jobject this)
 {
     jlong result = 0;
@@ -89,6 +131,15 @@ jlong java_lang_Number_longValue(JNIEnv* env, jobject this)
     return result;
 }
 
+jlong java_lang_Number_longValue_boxed(JNIEnv* env, jobject this)
+{
+    jlong result = 0;
+    if (JNI_METHOD(longValue, env, JNUMBER_TYPE, "longValue", "()J")) {
+        result = (*env)->CallLongMethod(env, this, longValue);
+    }
+    return result;
+}
+
 jshort java_lang_Number_shortValue(JNIEnv* env, jobject this)
 {
     jshort result = 0;
@@ -99,3 +150,12 @@ jshort java_lang_Number_shortValue(JNIEnv* env, jobject this)
     Py_END_ALLOW_THREADS
     return result;
 }
+
+jshort java_lang_Number_shortValue_boxed(JNIEnv* env, jobject this)
+{
+    jshort result = 0;
+    if (JNI_METHOD(shortValue, env, JNUMBER_TYPE, "shortValue", "()S")) {
+        result = (*env)->CallShortMethod(env, this, shortValue);
+    }
+    return result;
+}
@@ -47,6 +47,7 @@ BOOL APIENTRY DllMain(HANDLE hModule,
 JNIEXPORT jint JNICALL
 JNI_OnLoad(JavaVM *vm, void *reserved)
 {
+    pyembed_set_jvm(vm);
     return JNI_VERSION_1_2;
 }
 
@@ -784,6 +784,15 @@ static int set_type_attr_from_method_def(JNIEnv* env, jclass clazz,
     int result = PyObject_SetAttrString((PyObject*) t, methodDef->ml_name, a);
     Py_DECREF(a);
     Py_DECREF(t);
+    if (result == 0) {
+        JepModuleState *state = pyembed_get_module_state();
+        if (!state) {
+            return -1;
+        }
+        if (state->j2pConverters) {
+            PyDict_Clear(state->j2pConverters);
+        }
+    }
     return result;
 }
 
@@ -57,6 +57,12 @@ jclass JDOUBLE_ARRAY_TYPE  = NULL;
 #define DEFINE_CLASS_VAR(var, name) jclass var = NULL;
 CLASS_TABLE(DEFINE_CLASS_VAR)
 
+// canonical boxes for booleans and small integers
+jobject JBOOLEAN_TRUE  = NULL;
+jobject JBOOLEAN_FALSE = NULL;
+jobject JINTEGER_CACHE[JBOX_CACHE_SIZE];
+jobject JLONG_CACHE[JBOX_CACHE_SIZE];
+
 // get a const char* string from java string.
 // you *must* call release when you're finished with it.
 // returns local reference.
@@ -233,6 +239,68 @@ void unref_cache_frequent_classes(JNIEnv *env)
     CLASS_TABLE(UNCACHE_CLASS)
 }
 
+/*
+ * Stores a global reference to a box in a cache slot, the local reference
+ * is released. Returns 1 if successful, 0 if failed.
+ */
+static int cache_box(JNIEnv *env, jobject *slot, jobject box)
+{
+    if (!box) {
+        return 0;
+    }
+    *slot = (*env)->NewGlobalRef(env, box);
+    (*env)->DeleteLocalRef(env, box);
+    return *slot != NULL;
+}
+
+/*
+ * Caches the boxes that Python booleans and small integers are converted to
+ * so that the conversion does not need to allocate a new Java object. This
+ * must be called after cache_frequent_classes().
+ *
+ * Returns 1 if successful, 0 if failed.  Does not process Java exceptions.
+ */
+int cache_boxed_values(JNIEnv *env)
+{
+    int i;
+
+    if (JBOOLEAN_TRUE != NULL) {
+        return 1;
+    }
+    for (i = 0; i < JBOX_CACHE_SIZE; i++) {
+        if (!cache_box(env, &JINTEGER_CACHE[i],
+                       java_lang_Integer_valueOf(env, i + JBOX_CACHE_LOW))
+                || !cache_box(env, &JLONG_CACHE[i],
+                              java_lang_Long_valueOf(env, i + JBOX_CACHE_LOW))) {
+            unref_cache_boxed_values(env);
+            return 0;
+        }
+    }
+    /* Set last so a partially filled cache is never seen as complete. */
+    if (!cache_box(env, &JBOOLEAN_FALSE, java_lang_Boolean_valueOf(env, JNI_FALSE))
+            || !cache_box(env, &JBOOLEAN_TRUE, java_lang_Boolean_valueOf(env, JNI_TRUE))) {
+        unref_cache_boxed_values(env);
+        return 0;
+    }
+    return 1;
+}
+
+/*
+ * Releases the global references to the boxes that were setup in the above
+ * function.
+ */
+void unref_cache_boxed_values(JNIEnv *env)
+{
+    int i;
+
+    UNCACHE_CLASS(JBOOLEAN_TRUE,);
+    UNCACHE_CLASS(JBOOLEAN_FALSE,);
+    for (i = 0; i < JBOX_CACHE_SIZE; i++) {
+        UNCACHE_CLASS(JINTEGER_CACHE[i],);
+        UNCACHE_CLASS(JLONG_CACHE[i],);
+    }
+}
+
 
 // given the Class object, return the const ID.
 // -1 on error or NULL.
@@ -547,7 +615,43 @@ int pyarg_matches_jtype(JNIEnv *env,
 jvalue convert_pyarg_jvalue(JNIEnv *env, PyObject *param, jclass paramType,
                             int paramTypeId, int pos)
 {
-    jvalue ret = PyObject_As_jvalue(env, param, paramType);
+    jvalue ret;
+
+    // the type id is known, so skip comparing paramType to each primitive type
+    switch (paramTypeId) {
+    case JBOOLEAN_ID:
+        ret.z = PyObject_As_jboolean(param);
+        break;
+    case JBYTE_ID:
+        ret.b = PyObject_As_jbyte(param);
+        break;
+    case JCHAR_ID:
+        ret.c = PyObject_As_jchar(param);
+        break;
+    case JSHORT_ID:
+        ret.s = PyObject_As_jshort(param);
+        break;
+    case JINT_ID:
+        ret.i = PyObject_As_jint(param);
+        break;
+    case JLONG_ID:
+        ret.j = PyObject_As_jlong(param);
+        break;
+    case JFLOAT_ID:
+        ret.f = PyObject_As_jfloat(param);
+        break;
+    case JDOUBLE_ID:
+        ret.d = PyObject_As_jdouble(param);
+        break;
+    case JSTRING_ID:
+        if (PyUnicode_Check(param)) {
+            ret.l = PyObject_As_jstring(env, param);
+            break;
+        }
+    // fall through
+    default:
+        ret = PyObject_As_jvalue(env, param, paramType);
+    }
     if (PyErr_Occurred()) {
         PyObject *ptype, *pvalue, *ptrace, *pvalue_string;
         PyErr_Fetch(&ptype, &pvalue, &ptrace);
@@ -565,3 +669,41 @@ jvalue convert_pyarg_jvalue(JNIEnv *env, PyObject *param, jclass paramType,
     }
     return ret;
 }
+
+
+// create a new tuple containing the items of a C array of python objects.
+// returns NULL and sets a python exception on error.
+PyObject* pyargs_as_tuple(PyObject *const *args, Py_ssize_t len)
+{
+    Py_ssize_t i;
+    PyObject  *tuple = PyTuple_New(len);
+    if (!tuple) {
+        return NULL;
+    }
+    for (i = 0; i < len; i++) {
+        Py_INCREF(args[i]);
+        PyTuple_SET_ITEM(tuple, i, args[i]);
+    }
+    return tuple;
+}
+
+
+#if JEP_VECTORCALL
+// create a new dict from the keyword values and names of a vectorcall.
+// returns NULL and sets a python exception on error.
+PyObject* kwnames_as_dict(PyObject *const *kwvalues, PyObject *kwnames)
+{
+    Py_ssize_t i;
+    PyObject  *dict = PyDict_New();
+    if (!dict) {
+        return NULL;
+    }
+    for (i = 0; i < PyTuple_GET_SIZE(kwnames); i++) {
+        if (PyDict_SetItem(dict, PyTuple_GET_ITEM(kwnames, i), kwvalues[i])) {
+            Py_DECREF(dict);
+            return NULL;
+        }
+    }
+    return dict;
+}
+#endif
@@ -56,6 +56,10 @@
     #endif
 #endif
 
+#ifndef WIN32
+    #include <pthread.h>
+#endif
+
 #ifdef __APPLE__
     #ifndef WITH_NEXT_FRAMEWORK
         #include <crt_externs.h>
@@ -67,6 +71,27 @@
 
 static PyThreadState *mainThreadState = NULL;
 
+/*
+ * The JavaVM is saved when the jep library is loaded so that pyembed_get_env
+ * does not need to search for it. envKey and detachKey are only set on
+ * threads that were attached by jep. envKey holds the JNIEnv of the thread,
+ * it is not kept for other threads because they may be detached and attached
+ * again by other code. When a thread attached by jep exits the destructor of
+ * detachKey detaches it from the JVM.
+ */
+static JavaVM *cachedJVM = NULL;
+#ifdef WIN32
+    static DWORD envKey    = FLS_OUT_OF_INDEXES;
+    static DWORD detachKey = FLS_OUT_OF_INDEXES;
+    #define JEP_TLS_GET(key)        FlsGetValue(key)
+    #define JEP_TLS_SET(key, value) FlsSetValue(key, value)
+#else
+    static pthread_key_t envKey;
+    static pthread_key_t detachKey;
+    #define JEP_TLS_GET(key)        pthread_getspecific(key)
+    #define JEP_TLS_SET(key, value) pthread_setspecific(key, value)
+#endif
+
 /* Saved for cross thread access to shared modules. */
 static PyObject* mainThreadModules = NULL;
 static PyObject* mainThreadModulesLock = NULL;
@@ -78,6 +103,9 @@ static PyObject* pyembed_findclass(PyObject*, PyObject*);
 static PyObject* pyembed_forname(PyObject*, PyObject*);
 static PyObject* pyembed_jproxy(PyObject*, PyObject*);
 static PyObject* pyembed_set_j2p_converter(PyObject*, PyObject*);
+static PyObject* pyembed_set_string_cache(PyObject*, PyObject*);
+static PyObject* pyembed_set_iterator_chunk_size(PyObject*, PyObject*);
+static PyObject* pyembed_set_object_cache(PyObject*, PyObject*);
 
 static int maybe_pyc_file(FILE*, const char*, const char*, int);
 static void pyembed_run_pyc(JepThread*, FILE*);
@@ -124,6 +152,20 @@ static struct PyMethodDef jep_methods[] = {
         "  'd'         double\n"
     },
 
+    {
+        "jarrayFromBuffer",
+        pyjarray_from_buffer,
+        METH_VARARGS,
+        "Returns a new Java Array with a copy of the contents of an object that supports the buffer protocol.\n"
+        "Accepts:\n  "
+        "(buffer, typecode) or "
+        "(buffer, jclass)\n"
+        "\n"
+        "The buffer must be contiguous and use the native byte order. Its format must match the primitive\n"
+        "component type, for example 'd' for double or 'i' for int, but bytes objects and other unsigned byte\n"
+        "buffers can be copied into byte arrays."
+    },
+
     {
         "jproxy",
         pyembed_jproxy,
@@ -155,18 +197,89 @@ static struct PyMethodDef jep_methods[] = {
         "None can be set as the conversion function to remove any previously defined conversion function."
     },
 
+    {
+        "setJavaStringCache",
+        pyembed_set_string_cache,
+        METH_VARARGS,
+        "Cache the Python str objects created from short Java Strings.\n"
+        "\n"
+        "Accepts one argument: the maximum length of a String that is cached, or 0 to disable the cache.\n"
+        "\n"
+        "When the cache is enabled, converting a Java String that is equal to a recently converted String returns\n"
+        "the same str object instead of a new one. This reduces allocations when the same Strings are converted\n"
+        "repeatedly, such as Map keys, enum names or column names. The cache is disabled by default, it holds a\n"
+        "fixed number of strings for each interpreter and a new string replaces an older one with the same slot."
+    },
+
+    {
+        "setIteratorChunkSize",
+        pyembed_set_iterator_chunk_size,
+        METH_VARARGS,
+        "Set the number of elements fetched at once when Python iterates over a java.lang.Iterable.\n"
+        "\n"
+        "Accepts one argument: the number of elements, 1 fetches each element when it is needed and 0 restores\n"
+        "the default of 256.\n"
+        "\n"
+        "Fetching elements in chunks is much faster than fetching them one at a time. The Java Iterator that is\n"
+        "fetched in chunks is not visible to Python so it does not matter that it is ahead of the Python\n"
+        "iteration. Iterators returned from Java methods are always iterated one element at a time so calling\n"
+        "hasNext(), next() or remove() on them behaves as expected. A chunk size of 1 can be used for\n"
+        "Iterables that must not fetch elements early, such as cursors."
+    },
+
+    {
+        "setJavaObjectCache",
+        pyembed_set_object_cache,
+        METH_VARARGS,
+        "Return the same Python object each time the same Java object is converted.\n"
+        "\n"
+        "Accepts one argument: True to enable the cache or False to disable it.\n"
+        "\n"
+        "When the cache is enabled, converting a Java object that already has a live Python wrapper returns that\n"
+        "wrapper instead of creating a new one, so the is operator can compare Java objects and repeatedly\n"
+        "converting objects such as enum constants or singletons does not allocate. The cache does not keep\n"
+        "the wrappers alive, an entry is removed when its wrapper is garbage collected. The cache is disabled by\n"
+        "default, it is separate for each interpreter and disabling it removes all entries."
+    },
+
     { NULL, NULL }
 };
+
+static int jep_module_traverse(PyObject *modjep, visitproc visit, void *arg)
+{
+    JepModuleState *state = (JepModuleState*) PyModule_GetState(modjep);
+    if (state) {
+        Py_VISIT(state->j2pConverters);
+        return PyJType_TraverseCache(&state->typeCache, visit, arg);
+    }
+    return 0;
+}
+
+static void jep_module_free(void *modjep)
+{
+    JepModuleState *state = (JepModuleState*) PyModule_GetState(
+                                (PyObject*) modjep);
+    if (state) {
+        Py_CLEAR(state->j2pConverters);
+        pyembed_clear_string_cache(state);
+        PyJObject_SetCacheEnabled(&state->objectCache, 0);
+        JNIEnv *env = pyembed_get_env();
+        if (env) {
+            PyJType_FreeCache(env, &state->typeCache);
+        }
+    }
+}
+
 static struct PyModuleDef jep_module_def = {
     PyModuleDef_HEAD_INIT,
-    "_jep",              /* m_name */
-    "_jep",              /* m_doc */
-    0,                   /* m_size */
-    jep_methods,         /* m_methods */
-    NULL,                /* m_reload */
-    NULL,                /* m_traverse */
-    NULL,                /* m_clear */
-    NULL,                /* m_free */
+    "_jep",                  /* m_name */
+    "_jep",                  /* m_doc */
+    sizeof(JepModuleState),  /* m_size */
+    jep_methods,             /* m_methods */
+    NULL,                    /* m_reload */
+    jep_module_traverse,     /* m_traverse */
+    NULL,                    /* m_clear */
+    jep_module_free,         /* m_free */
 };
 
 /*
@@ -526,6 +639,44 @@ int pyembed_is_version_unsafe(void)
 }
 
 
+#ifdef WIN32
+static VOID WINAPI pyembed_detach_thread(PVOID vm)
+#else
+static void pyembed_detach_thread(void *vm)
+#endif
+{
+    JavaVM *jvm = (JavaVM*) vm;
+    if (jvm && jvm == cachedJVM) {
+        (*jvm)->DetachCurrentThread(jvm);
+    }
+}
+
+
+void pyembed_set_jvm(JavaVM *vm)
+{
+#ifdef WIN32
+    envKey = FlsAlloc(NULL);
+    if (envKey == FLS_OUT_OF_INDEXES) {
+        return;
+    }
+    detachKey = FlsAlloc(pyembed_detach_thread);
+    if (detachKey == FLS_OUT_OF_INDEXES) {
+        FlsFree(envKey);
+        return;
+    }
+#else
+    if (pthread_key_create(&envKey, NULL) != 0) {
+        return;
+    }
+    if (pthread_key_create(&detachKey, pyembed_detach_thread) != 0) {
+        pthread_key_delete(envKey);
+        return;
+    }
+#endif
+    cachedJVM = vm;
+}
+
+
 void pyembed_shutdown(JavaVM *vm)
 {
     JNIEnv *env;
@@ -534,11 +685,24 @@ void pyembed_shutdown(JavaVM *vm)
     PyEval_AcquireThread(mainThreadState);
     Py_Finalize();
 
+    if (cachedJVM) {
+        // the VM is going away, threads must not try to detach from it.
+        cachedJVM = NULL;
+#ifdef WIN32
+        FlsFree(detachKey);
+        FlsFree(envKey);
+#else
+        pthread_key_delete(detachKey);
+        pthread_key_delete(envKey);
+#endif
+    }
+
     if ((*vm)->GetEnv(vm, (void **) &env, JNI_VERSION_1_6) != JNI_OK) {
         // failed to get a JNIEnv*, we can hope it's just shutting down fast
         return;
     } else {
         // delete global references
+        unref_cache_boxed_values(env);
         unref_cache_primitive_classes(env);
         unref_cache_frequent_classes(env);
     }
@@ -652,6 +816,10 @@ intptr_t pyembed_thread_init(JNIEnv *env, jobject cl, jobject caller,
     if (!cache_primitive_classes(env)) {
         printf("WARNING: Failed to get and cache primitive class types!\n");
     }
+    if (!cache_boxed_values(env)) {
+        (*env)->ExceptionClear(env);
+        printf("WARNING: Failed to get and cache boxed values!\n");
+    }
 
     if (usesubinterpreter) {
         PyObject *mod_main = PyImport_AddModule("__main__");    /* borrowed */
@@ -739,6 +907,28 @@ JNIEnv* pyembed_get_env(void)
     JNIEnv *env;
     jsize nVMs;
 
+    if (cachedJVM) {
+        env = (JNIEnv*) JEP_TLS_GET(envKey);
+        if (env) {
+            return env;
+        }
+        if ((*cachedJVM)->GetEnv(cachedJVM, (void**) &env,
+                                 JNI_VERSION_1_6) != JNI_EDETACHED) {
+            return env;
+        }
+        /*
+         * This is a new thread started by Python. Daemon allows Java
+         * to exit even if the thread is still running, the thread is
+         * detached by pyembed_detach_thread when it exits.
+         */
+        if ((*cachedJVM)->AttachCurrentThreadAsDaemon(cachedJVM, (void**) &env,
+                NULL) != JNI_OK) {
+            return NULL;
+        }
+        JEP_TLS_SET(detachKey, cachedJVM);
+        JEP_TLS_SET(envKey, env);
+        return env;
+    }
 
     JNI_GetCreatedJavaVMs(&jvm, 1, &nVMs);
     /*
@@ -786,6 +976,24 @@ PyObject* pyembed_get_jep_module(void)
     return modjep;
 }
 
+JepModuleState* pyembed_get_module_state(void)
+{
+    PyObject* modjep = pyembed_get_jep_module();
+    if (!modjep) {
+        return NULL;
+    }
+    return (JepModuleState*) PyModule_GetState(modjep);
+}
+
+JepModuleState* pyembed_find_module_state(void)
+{
+    PyObject* modjep = PyState_FindModule(&jep_module_def);
+    if (!modjep) {
+        return NULL;
+    }
+    return (JepModuleState*) PyModule_GetState(modjep);
+}
+
 static PyObject* pyembed_jproxy(PyObject *self, PyObject *args)
 {
     JepThread     *jepThread;
@@ -865,8 +1073,9 @@ static PyObject* pyembed_jproxy(PyObject *self, PyObject *args)
 
 static PyObject* pyembed_set_j2p_converter(PyObject *self, PyObject *args)
 {
-    PyObject      *pytarget;
-    PyObject      *topy;
+    JepModuleState *state;
+    PyObject       *pytarget;
+    PyObject       *topy;
 
     if (!PyArg_ParseTuple(args, "OO:setJavaToPythonConverter",
                           &pytarget,
@@ -900,6 +1109,84 @@ static PyObject* pyembed_set_j2p_converter(PyObject *self, PyObject *args)
                         "Second argument to setJavaToPythonConverter must be Callable");
         return NULL;
     }
+    /* The converter is inherited so every resolved type may have changed. */
+    state = (JepModuleState*) PyModule_GetState(self);
+    if (state && state->j2pConverters) {
+        PyDict_Clear(state->j2pConverters);
+    }
+    Py_RETURN_NONE;
+}
+
+void pyembed_clear_string_cache(JepModuleState *state)
+{
+    if (state->stringCache) {
+        int i;
+        for (i = 0; i < JEP_STRING_CACHE_SIZE; i++) {
+            Py_CLEAR(state->stringCache[i]);
+        }
+        PyMem_Free(state->stringCache);
+        state->stringCache = NULL;
+    }
+}
+
+static PyObject* pyembed_set_string_cache(PyObject *self, PyObject *args)
+{
+    JepModuleState *state;
+    int             maxLength;
+
+    if (!PyArg_ParseTuple(args, "i:setJavaStringCache", &maxLength)) {
+        return NULL;
+    }
+    if (maxLength < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "The maximum length for setJavaStringCache cannot be negative");
+        return NULL;
+    }
+    state = (JepModuleState*) PyModule_GetState(self);
+    if (!state) {
+        return NULL;
+    }
+    state->stringCacheLength = maxLength;
+    if (maxLength == 0) {
+        pyembed_clear_string_cache(state);
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject* pyembed_set_iterator_chunk_size(PyObject *self, PyObject *args)
+{
+    JepModuleState *state;
+    int             chunkSize;
+
+    if (!PyArg_ParseTuple(args, "i:setIteratorChunkSize", &chunkSize)) {
+        return NULL;
+    }
+    if (chunkSize < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "The chunk size for setIteratorChunkSize cannot be negative");
+        return NULL;
+    }
+    state = (JepModuleState*) PyModule_GetState(self);
+    if (!state) {
+        return NULL;
+    }
+    state->iteratorChunkSize = chunkSize;
+    Py_RETURN_NONE;
+}
+
+static PyObject* pyembed_set_object_cache(PyObject *self, PyObject *args)
+{
+    JepModuleState *state;
+    int             enabled;
+
+    if (!PyArg_ParseTuple(args, "p:setJavaObjectCache", &enabled)) {
+        return NULL;
+    }
+    state = (JepModuleState*) PyModule_GetState(self);
+    if (!state) {
+        return NULL;
+    }
+    PyJObject_SetCacheEnabled(&state->objectCache, enabled);
     Py_RETURN_NONE;
 }
 
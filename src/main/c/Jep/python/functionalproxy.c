@@ -0,0 +1,339 @@
+/*
+   jep - Java Embedded Python
+
+   Copyright (c) 2024 JEP AUTHORS.
+
+   This file is licensed under the the zlib/libpng License.
+
+   This software is provided 'as-is', without any express or implied
+   warranty. In no event will the authors be held liable for any
+   damages arising from the use of this software.
+
+   Permission is granted to anyone to use this software for any
+   purpose, including commercial applications, and to alter it and
+   redistribute it freely, subject to the following restrictions:
+
+   1. The origin of this software must not be misrepresented; you
+   must not claim that you wrote the original software. If you use
+   this software in a product, an acknowledgment in the product
+   documentation would be appreciated but is not required.
+
+   2. Altered source versions must be plainly marked as such, and
+   must not be misrepresented as being the original software.
+
+   3. This notice may not be removed or altered from any source
+   distribution.
+*/
+
+#include "Jep.h"
+
+#include "jep_python_FunctionalProxy.h"
+
+/*
+ * The native methods of jep.python.FunctionalProxy. Each one is for a single
+ * signature so the arguments and the result are converted without looking at
+ * the Method that is called. These functions are called by java so errors are
+ * thrown as java exceptions.
+ */
+
+/*
+ * Throw the Python exception, if there is one, the way java.lang.reflect.Proxy
+ * would. The methods of the interfaces do not declare checked exceptions so
+ * those, including JepException, are wrapped in an
+ * UndeclaredThrowableException.
+ */
+static void throwPyException(JNIEnv *env)
+{
+    jthrowable exc, wrapper;
+
+    if (!process_py_exception(env)) {
+        return;
+    }
+    exc = (*env)->ExceptionOccurred(env);
+    if (!exc) {
+        return;
+    }
+    if ((*env)->IsInstanceOf(env, exc, RUNTIME_EXC_TYPE)
+            || (*env)->IsInstanceOf(env, exc, ERROR_EXC_TYPE)) {
+        (*env)->DeleteLocalRef(env, exc);
+        return;
+    }
+    (*env)->ExceptionClear(env);
+    wrapper = java_lang_reflect_UndeclaredThrowableException_new_Throwable(env,
+              exc);
+    if (wrapper) {
+        (*env)->Throw(env, wrapper);
+        (*env)->DeleteLocalRef(env, wrapper);
+    }
+    (*env)->DeleteLocalRef(env, exc);
+}
+
+/*
+ * Call the target with one or two arguments, the references to the arguments
+ * are stolen and arg2 is NULL when there is only one argument. Returns a new
+ * reference or NULL if an error occurred, the GIL must be held.
+ */
+static PyObject* callTarget(jlong target, int nargs, PyObject *arg1,
+                            PyObject *arg2)
+{
+    PyObject *result = NULL;
+    if (arg1 && (nargs == 1 || arg2)) {
+        result = PyObject_CallFunctionObjArgs((PyObject*) target, arg1, arg2, NULL);
+    }
+    Py_XDECREF(arg1);
+    Py_XDECREF(arg2);
+    return result;
+}
+
+/*
+ * Class:     jep_python_FunctionalProxy
+ * Method:    applyObject
+ * Signature: (JJLjava/lang/Object;)Ljava/lang/Object;
+ */
+JNIEXPORT jobject JNICALL Java_jep_python_FunctionalProxy_applyObject
+(JNIEnv *env, jclass clazz, jlong tstate, jlong target, jobject arg)
+{
+    JepThread *jepThread = (JepThread*) tstate;
+    PyObject  *pyresult;
+    jobject    result    = NULL;
+
+    PyEval_AcquireThread(jepThread->tstate);
+    pyresult = callTarget(target, 1, jobject_As_PyObject(env, arg), NULL);
+    if (pyresult) {
+        result = PyObject_As_jobject(env, pyresult, JOBJECT_TYPE);
+        Py_DECREF(pyresult);
+    }
+    throwPyException(env);
+    PyEval_ReleaseThread(jepThread->tstate);
+    return result;
+}
+
+/*
+ * Class:     jep_python_FunctionalProxy
+ * Method:    acceptObject
+ * Signature: (JJLjava/lang/Object;)V
+ */
+JNIEXPORT void JNICALL Java_jep_python_FunctionalProxy_acceptObject
+(JNIEnv *env, jclass clazz, jlong tstate, jlong target, jobject arg)
+{
+    JepThread *jepThread = (JepThread*) tstate;
+    PyObject  *pyresult;
+
+    PyEval_AcquireThread(jepThread->tstate);
+    /* The result of a Consumer is ignored so it is not converted. */
+    pyresult = callTarget(target, 1, jobject_As_PyObject(env, arg), NULL);
+    Py_XDECREF(pyresult);
+    throwPyException(env);
+    PyEval_ReleaseThread(jepThread->tstate);
+}
+
+/*
+ * Class:     jep_python_FunctionalProxy
+ * Method:    compareObjects
+ * Signature: (JJLjava/lang/Object;Ljava/lang/Object;)I
+ */
+JNIEXPORT jint JNICALL Java_jep_python_FunctionalProxy_compareObjects
+(JNIEnv *env, jclass clazz, jlong tstate, jlong target, jobject arg1,
+ jobject arg2)
+{
+    JepThread *jepThread = (JepThread*) tstate;
+    PyObject  *pyarg1;
+    PyObject  *pyresult;
+    jint       result    = 0;
+
+    PyEval_AcquireThread(jepThread->tstate);
+    pyarg1 = jobject_As_PyObject(env, arg1);
+    pyresult = callTarget(target, 2, pyarg1,
+                          pyarg1 ? jobject_As_PyObject(env, arg2) : NULL);
+    if (pyresult) {
+        result = PyObject_As_jint(pyresult);
+        Py_DECREF(pyresult);
+    }
+    throwPyException(env);
+    PyEval_ReleaseThread(jepThread->tstate);
+    return result;
+}
+
+/*
+ * Class:     jep_python_FunctionalProxy
+ * Method:    testObject
+ * Signature: (JJLjava/lang/Object;)Z
+ */
+JNIEXPORT jboolean JNICALL Java_jep_python_FunctionalProxy_testObject
+(JNIEnv *env, jclass clazz, jlong tstate, jlong target, jobject arg)
+{
+    JepThread *jepThread = (JepThread*) tstate;
+    PyObject  *pyresult;
+    jboolean   result    = JNI_FALSE;
+
+    PyEval_AcquireThread(jepThread->tstate);
+    pyresult = callTarget(target, 1, jobject_As_PyObject(env, arg), NULL);
+    if (pyresult) {
+        result = PyObject_As_jboolean(pyresult);
+        Py_DECREF(pyresult);
+    }
+    throwPyException(env);
+    PyEval_ReleaseThread(jepThread->tstate);
+    return result;
+}
+
+/*
+ * Class:     jep_python_FunctionalProxy
+ * Method:    applyObjectAsInt
+ * Signature: (JJLjava/lang/Object;)I
+ */
+JNIEXPORT jint JNICALL Java_jep_python_FunctionalProxy_applyObjectAsInt
+(JNIEnv *env, jclass clazz, jlong tstate, jlong target, jobject arg)
+{
+    JepThread *jepThread = (JepThread*) tstate;
+    PyObject  *pyresult;
+    jint       result    = 0;
+
+    PyEval_AcquireThread(jepThread->tstate);
+    pyresult = callTarget(target, 1, jobject_As_PyObject(env, arg), NULL);
+    if (pyresult) {
+        result = PyObject_As_jint(pyresult);
+        Py_DECREF(pyresult);
+    }
+    throwPyException(env);
+    PyEval_ReleaseThread(jepThread->tstate);
+    return result;
+}
+
+/*
+ * Class:     jep_python_FunctionalProxy
+ * Method:    applyObjectAsLong
+ * Signature: (JJLjava/lang/Object;)J
+ */
+JNIEXPORT jlong JNICALL Java_jep_python_FunctionalProxy_applyObjectAsLong
+(JNIEnv *env, jclass clazz, jlong tstate, jlong target, jobject arg)
+{
+    JepThread *jepThread = (JepThread*) tstate;
+    PyObject  *pyresult;
+    jlong      result    = 0;
+
+    PyEval_AcquireThread(jepThread->tstate);
+    pyresult = callTarget(target, 1, jobject_As_PyObject(env, arg), NULL);
+    if (pyresult) {
+        result = PyObject_As_jlong(pyresult);
+        Py_DECREF(pyresult);
+    }
+    throwPyException(env);
+    PyEval_ReleaseThread(jepThread->tstate);
+    return result;
+}
+
+/*
+ * Class:     jep_python_FunctionalProxy
+ * Method:    applyObjectAsDouble
+ * Signature: (JJLjava/lang/Object;)D
+ */
+JNIEXPORT jdouble JNICALL Java_jep_python_FunctionalProxy_applyObjectAsDouble
+(JNIEnv *env, jclass clazz, jlong tstate, jlong target, jobject arg)
+{
+    JepThread *jepThread = (JepThread*) tstate;
+    PyObject  *pyresult;
+    jdouble    result    = 0;
+
+    PyEval_AcquireThread(jepThread->tstate);
+    pyresult = callTarget(target, 1, jobject_As_PyObject(env, arg), NULL);
+    if (pyresult) {
+        result = PyObject_As_jdouble(pyresult);
+        Py_DECREF(pyresult);
+    }
+    throwPyException(env);
+    PyEval_ReleaseThread(jepThread->tstate);
+    return result;
+}
+
+/*
+ * Class:     jep_python_FunctionalProxy
+ * Method:    testInt
+ * Signature: (JJI)Z
+ */
+JNIEXPORT jboolean JNICALL Java_jep_python_FunctionalProxy_testInt
+(JNIEnv *env, jclass clazz, jlong tstate, jlong target, jint arg)
+{
+    JepThread *jepThread = (JepThread*) tstate;
+    PyObject  *pyresult;
+    jboolean   result    = JNI_FALSE;
+
+    PyEval_AcquireThread(jepThread->tstate);
+    pyresult = callTarget(target, 1, jint_As_PyObject(arg), NULL);
+    if (pyresult) {
+        result = PyObject_As_jboolean(pyresult);
+        Py_DECREF(pyresult);
+    }
+    throwPyException(env);
+    PyEval_ReleaseThread(jepThread->tstate);
+    return result;
+}
+
+/*
+ * Class:     jep_python_FunctionalProxy
+ * Method:    applyIntAsInt
+ * Signature: (JJI)I
+ */
+JNIEXPORT jint JNICALL Java_jep_python_FunctionalProxy_applyIntAsInt
+(JNIEnv *env, jclass clazz, jlong tstate, jlong target, jint arg)
+{
+    JepThread *jepThread = (JepThread*) tstate;
+    PyObject  *pyresult;
+    jint       result    = 0;
+
+    PyEval_AcquireThread(jepThread->tstate);
+    pyresult = callTarget(target, 1, jint_As_PyObject(arg), NULL);
+    if (pyresult) {
+        result = PyObject_As_jint(pyresult);
+        Py_DECREF(pyresult);
+    }
+    throwPyException(env);
+    PyEval_ReleaseThread(jepThread->tstate);
+    return result;
+}
+
+/*
+ * Class:     jep_python_FunctionalProxy
+ * Method:    applyLongAsLong
+ * Signature: (JJJ)J
+ */
+JNIEXPORT jlong JNICALL Java_jep_python_FunctionalProxy_applyLongAsLong
+(JNIEnv *env, jclass clazz, jlong tstate, jlong target, jlong arg)
+{
+    JepThread *jepThread = (JepThread*) tstate;
+    PyObject  *pyresult;
+    jlong      result    = 0;
+
+    PyEval_AcquireThread(jepThread->tstate);
+    pyresult = callTarget(target, 1, jlong_As_PyObject(arg), NULL);
+    if (pyresult) {
+        result = PyObject_As_jlong(pyresult);
+        Py_DECREF(pyresult);
+    }
+    throwPyException(env);
+    PyEval_ReleaseThread(jepThread->tstate);
+    return result;
+}
+
+/*
+ * Class:     jep_python_FunctionalProxy
+ * Method:    applyDoubleAsDouble
+ * Signature: (JJD)D
+ */
+JNIEXPORT jdouble JNICALL Java_jep_python_FunctionalProxy_applyDoubleAsDouble
+(JNIEnv *env, jclass clazz, jlong tstate, jlong target, jdouble arg)
+{
+    JepThread *jepThread = (JepThread*) tstate;
+    PyObject  *pyresult;
+    jdouble    result    = 0;
+
+    PyEval_AcquireThread(jepThread->tstate);
+    pyresult = callTarget(target, 1, jdouble_As_PyObject(arg), NULL);
+    if (pyresult) {
+        result = PyObject_As_jdouble(pyresult);
+        Py_DECREF(pyresult);
+    }
+    throwPyException(env);
+    PyEval_ReleaseThread(jepThread->tstate);
+    return result;
+}
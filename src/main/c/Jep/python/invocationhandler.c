@@ -30,221 +30,231 @@
 #include "jep_python_InvocationHandler.h"
 
 
-static jobject invokeDefault(JNIEnv *env, jobject obj, jobject method,
-                             jobjectArray args)
+/* Calls of default methods with more arguments than this allocate argVals */
+#define DEFAULT_STACK_ARGS 8
+
+/*
+ * Call the default implementation of a method that Python does not
+ * implement. The method ID and the type ids of the parameters and the return
+ * value are found by the Java InvocationHandler the first time the method is
+ * invoked, so this does not use reflection.
+ */
+static jobject invokeDefault(JNIEnv *env, jobject obj, jobjectArray args,
+                             jclass interface, jmethodID methodID,
+                             jintArray parameterTypes, jint retType)
 {
-    jclass       interface = NULL;
-    jmethodID    methodID  = NULL;
-    jobjectArray argTypes  = NULL;
-    jsize        argLen    = 0;
-    jvalue      *argVals   = NULL;
-    jsize        i         = 0;
-    jclass       retType   = NULL;
-    jobject      result    = NULL;
+    jvalue   stackVals[DEFAULT_STACK_ARGS];
+    jint     stackTypes[DEFAULT_STACK_ARGS];
+    jvalue  *argVals  = stackVals;
+    jint    *argTypes = stackTypes;
+    jsize    argLen   = 0;
+    jsize    i        = 0;
+    jobject  result   = NULL;
 
     if (args) {
-        argTypes = java_lang_reflect_Executable_getParameterTypes(env, method);
-        if ((*env)->ExceptionOccurred(env)) {
+        argLen = (*env)->GetArrayLength(env, parameterTypes);
+    }
+    if (argLen > DEFAULT_STACK_ARGS) {
+        argVals = (jvalue *) PyMem_Malloc((sizeof(jvalue) + sizeof(jint)) * argLen);
+        if (!argVals) {
+            THROW_JEP(env, "Out of memory");
             return NULL;
         }
-        argLen = (*env)->GetArrayLength(env, args);
+        argTypes = (jint *) (argVals + argLen);
     }
-    argVals = (jvalue *) PyMem_Malloc(sizeof(jvalue) * argLen);
-    for (i = 0 ; i < argLen ; i += 1) {
-        jobject type = (*env)->GetObjectArrayElement(env, argTypes, i);
+    (*env)->GetIntArrayRegion(env, parameterTypes, 0, argLen, argTypes);
+    for (i = 0 ; i < argLen && !(*env)->ExceptionCheck(env); i += 1) {
         jobject arg = (*env)->GetObjectArrayElement(env, args, i);
-        if ((*env)->IsAssignableFrom(env, type, JOBJECT_TYPE)) {
-            argVals[i].l = arg;
-        } else if ((*env)->IsSameObject(env, type, JBOOLEAN_TYPE)) {
+        switch (argTypes[i]) {
+        case JBOOLEAN_ID:
             argVals[i].z = java_lang_Boolean_booleanValue(env, arg);
-        } else if ((*env)->IsSameObject(env, type, JBYTE_TYPE)) {
-            argVals[i].b = java_lang_Number_byteValue(env, arg);
-        } else if ((*env)->IsSameObject(env, type, JCHAR_TYPE)) {
+            break;
+        case JBYTE_ID:
+            argVals[i].b = java_lang_Number_byteValue_boxed(env, arg);
+            break;
+        case JCHAR_ID:
             argVals[i].c = java_lang_Character_charValue(env, arg);
-        } else if ((*env)->IsSameObject(env, type, JSHORT_TYPE)) {
-            argVals[i].s = java_lang_Number_shortValue(env, arg);
-        } else if ((*env)->IsSameObject(env, type, JINT_TYPE)) {
-            argVals[i].i = java_lang_Number_intValue(env, arg);
-        } else if ((*env)->IsSameObject(env, type, JLONG_TYPE)) {
-            argVals[i].j = java_lang_Number_longValue(env, arg);
-        } else if ((*env)->IsSameObject(env, type, JFLOAT_TYPE)) {
-            argVals[i].f = java_lang_Number_floatValue(env, arg);
-        } else if ((*env)->IsSameObject(env, type, JDOUBLE_TYPE)) {
-            argVals[i].d = java_lang_Number_doubleValue(env, arg);
+            break;
+        case JSHORT_ID:
+            argVals[i].s = java_lang_Number_shortValue_boxed(env, arg);
+            break;
+        case JINT_ID:
+            argVals[i].i = java_lang_Number_intValue_boxed(env, arg);
+            break;
+        case JLONG_ID:
+            argVals[i].j = java_lang_Number_longValue_boxed(env, arg);
+            break;
+        case JFLOAT_ID:
+            argVals[i].f = java_lang_Number_floatValue_boxed(env, arg);
+            break;
+        case JDOUBLE_ID:
+            argVals[i].d = java_lang_Number_doubleValue_boxed(env, arg);
+            break;
+        default:
+            argVals[i].l = arg;
+            continue;
         }
-        (*env)->DeleteLocalRef(env, type);
-    }
-    interface = java_lang_reflect_Member_getDeclaringClass(env, method);
-    if ((*env)->ExceptionOccurred(env)) {
-        return NULL;
+        (*env)->DeleteLocalRef(env, arg);
     }
-    methodID = (*env)->FromReflectedMethod(env, method);
-    retType = java_lang_reflect_Method_getReturnType(env, method);
-    if ((*env)->ExceptionOccurred(env)) {
-        return NULL;
+    if ((*env)->ExceptionCheck(env)) {
+        goto EXIT;
     }
+
     Py_BEGIN_ALLOW_THREADS;
-    if ((*env)->IsAssignableFrom(env, retType, JOBJECT_TYPE)) {
-        result = (*env)->CallNonvirtualObjectMethodA(env, obj, interface, methodID,
-                 argVals);
-    } else if ((*env)->IsSameObject(env, retType, JBOOLEAN_TYPE)) {
+    switch (retType) {
+    case JBOOLEAN_ID: {
         jboolean z = (*env)->CallNonvirtualBooleanMethodA(env, obj, interface,
                      methodID, argVals);
-        if (!(*env)->ExceptionOccurred(env)) {
+        if (!(*env)->ExceptionCheck(env)) {
             result = java_lang_Boolean_new_Z(env, z);
         }
-    } else if ((*env)->IsSameObject(env, retType, JBYTE_TYPE)) {
+        break;
+    }
+    case JBYTE_ID: {
         jbyte b = (*env)->CallNonvirtualByteMethodA(env, obj, interface, methodID,
                   argVals);
-        if (!(*env)->ExceptionOccurred(env)) {
+        if (!(*env)->ExceptionCheck(env)) {
             result = java_lang_Byte_new_B(env, b);
         }
-    } else if ((*env)->IsSameObject(env, retType, JCHAR_TYPE)) {
+        break;
+    }
+    case JCHAR_ID: {
         jchar c = (*env)->CallNonvirtualCharMethodA(env, obj, interface, methodID,
                   argVals);
-        if (!(*env)->ExceptionOccurred(env)) {
+        if (!(*env)->ExceptionCheck(env)) {
             result = java_lang_Character_new_C(env, c);
         }
-    } else if ((*env)->IsSameObject(env, retType, JSHORT_TYPE)) {
-        jchar s = (*env)->CallNonvirtualShortMethodA(env, obj, interface, methodID,
-                  argVals);
-        if (!(*env)->ExceptionOccurred(env)) {
+        break;
+    }
+    case JSHORT_ID: {
+        jshort s = (*env)->CallNonvirtualShortMethodA(env, obj, interface, methodID,
+                   argVals);
+        if (!(*env)->ExceptionCheck(env)) {
             result = java_lang_Short_new_S(env, s);
         }
-    } else if ((*env)->IsSameObject(env, retType, JINT_TYPE)) {
+        break;
+    }
+    case JINT_ID: {
         jint i = (*env)->CallNonvirtualIntMethodA(env, obj, interface, methodID,
                  argVals);
-        if (!(*env)->ExceptionOccurred(env)) {
+        if (!(*env)->ExceptionCheck(env)) {
             result = java_lang_Integer_new_I(env, i);
         }
-    } else if ((*env)->IsSameObject(env, retType, JLONG_TYPE)) {
+        break;
+    }
+    case JLONG_ID: {
         jlong j = (*env)->CallNonvirtualLongMethodA(env, obj, interface, methodID,
                   argVals);
-        if (!(*env)->ExceptionOccurred(env)) {
+        if (!(*env)->ExceptionCheck(env)) {
             result = java_lang_Long_new_J(env, j);
         }
-    } else if ((*env)->IsSameObject(env, retType, JFLOAT_TYPE)) {
+        break;
+    }
+    case JFLOAT_ID: {
         jfloat f = (*env)->CallNonvirtualFloatMethodA(env, obj, interface,
                    methodID, argVals);
-        if (!(*env)->ExceptionOccurred(env)) {
+        if (!(*env)->ExceptionCheck(env)) {
             result = java_lang_Float_new_F(env, f);
         }
-    } else if ((*env)->IsSameObject(env, retType, JDOUBLE_TYPE)) {
+        break;
+    }
+    case JDOUBLE_ID: {
         jdouble d = (*env)->CallNonvirtualDoubleMethodA(env, obj, interface,
                     methodID, argVals);
-        if (!(*env)->ExceptionOccurred(env)) {
+        if (!(*env)->ExceptionCheck(env)) {
             result = java_lang_Double_new_D(env, d);
         }
-    } else if ((*env)->IsSameObject(env, retType, JVOID_TYPE)) {
+        break;
+    }
+    case JVOID_ID:
         (*env)->CallNonvirtualVoidMethodA(env, obj, interface, methodID, argVals);
+        break;
+    default:
+        result = (*env)->CallNonvirtualObjectMethodA(env, obj, interface, methodID,
+                 argVals);
     }
     Py_END_ALLOW_THREADS;
+EXIT:
+    if (argVals != stackVals) {
+        PyMem_Free(argVals);
+    }
     return result;
 }
 
-/**
- * The return type for a method may be a primitive class but the interface for
- * InvocationHandler requires a boxed type, so this returns the box type for
- * primitives so that the jep conversion has the right expected type.
+/*
+ * Class:     jep_python_InvocationHandler
+ * Method:    getMethodID
+ * Signature: (Ljava/lang/reflect/Method;)J
  */
-static jclass getObjectReturnType(JNIEnv *env, jclass retType)
+JNIEXPORT jlong JNICALL Java_jep_python_InvocationHandler_getMethodID(
+    JNIEnv *env, jclass class, jobject method)
 {
-    jclass result = NULL;
-    if ((*env)->IsAssignableFrom(env, retType, JOBJECT_TYPE)) {
-        result = retType;
-    } else if ((*env)->IsSameObject(env, retType, JBOOLEAN_TYPE)) {
-        result = JBOOL_OBJ_TYPE;
-    } else if ((*env)->IsSameObject(env, retType, JBYTE_TYPE)) {
-        result = JBYTE_OBJ_TYPE;
-    } else if ((*env)->IsSameObject(env, retType, JCHAR_TYPE)) {
-        result = JCHAR_OBJ_TYPE;
-    } else if ((*env)->IsSameObject(env, retType, JSHORT_TYPE)) {
-        result = JSHORT_OBJ_TYPE;
-    } else if ((*env)->IsSameObject(env, retType, JINT_TYPE)) {
-        result = JINT_OBJ_TYPE;
-    } else if ((*env)->IsSameObject(env, retType, JLONG_TYPE)) {
-        result = JLONG_OBJ_TYPE;
-    } else if ((*env)->IsSameObject(env, retType, JFLOAT_TYPE)) {
-        result = JFLOAT_OBJ_TYPE;
-    } else if ((*env)->IsSameObject(env, retType, JDOUBLE_TYPE)) {
-        result = JDOUBLE_OBJ_TYPE;
-    } else if ((*env)->IsSameObject(env, retType, JVOID_TYPE)) {
-        /*
-         * Maybe the jep conversion should require None for Void but
-         * the Proxy code seems to accept anything so just go with that
-         */
-        result = JOBJECT_TYPE;
-    } else {
-        /* Nothing should make it here but just in case. */
-        result = retType;
-    }
-    return result;
+    return (jlong) (intptr_t) (*env)->FromReflectedMethod(env, method);
 }
 
+/* Method names longer than this are copied to a new buffer */
+#define STACK_NAME_LENGTH 128
+
 /*
  * Note that this function is called by java so it should throw java exceptions.
  *
- * Class:     jep_InvocationHandler
+ * Everything about the method is found by the Java InvocationHandler the
+ * first time the method is invoked and passed in, so no reflection is needed
+ * here. The name is UTF-8 with a terminating 0.
+ *
+ * Class:     jep_python_InvocationHandler
  * Method:    invoke
- * Signature: (Ljava/lang/Object;JJLjava/lang/reflect/Method;[Ljava/lang/Object;Z
+ * Signature: (Ljava/lang/Object;JJ[Ljava/lang/Object;ZZ[BLjava/lang/Class;Ljava/lang/Class;J[II)Ljava/lang/Object;
  */
 JNIEXPORT jobject JNICALL Java_jep_python_InvocationHandler_invoke(JNIEnv *env,
-        jclass class, jobject obj, jlong _jepThread, jlong _target, jobject method,
-        jobjectArray args, jboolean functionalInterface
-                                                                  )
+        jclass class, jobject obj, jlong _jepThread, jlong _target,
+        jobjectArray args, jboolean callTarget, jboolean abstract,
+        jbyteArray name, jclass retType, jclass interface, jlong methodID,
+        jintArray parameterTypes, jint primitiveRetType)
 {
     JepThread     *jepThread = NULL;
     PyObject      *target    = NULL;
     jobject        result    = NULL;
-    jclass         retType   = NULL;
-    jint           modifiers;
-    jboolean       abstract;
 
     target   = (PyObject *) _target;
     jepThread = (JepThread *) _jepThread;
 
-    modifiers = java_lang_reflect_Member_getModifiers(env, method);
-    if ((*env)->ExceptionOccurred(env)) {
-        return NULL;
-    }
-    abstract = java_lang_reflect_Modifier_isAbstract(env, modifiers);
-    if ((*env)->ExceptionOccurred(env)) {
-        return NULL;
-    }
-    retType = java_lang_reflect_Method_getReturnType(env, method);
-    if ((*env)->ExceptionOccurred(env)) {
-        return NULL;
-    }
-    retType = getObjectReturnType(env, retType);
-
-    if (functionalInterface && abstract) {
+    if (callTarget) {
         PyEval_AcquireThread(jepThread->tstate);
         result = pyembed_invoke_as(env, target, args, NULL, retType);
         PyEval_ReleaseThread(jepThread->tstate);
     } else {
-        const char* attrName;
-        jstring name = java_lang_reflect_Member_getName(env, method);
-        if ((*env)->ExceptionOccurred(env)) {
-            return NULL;
+        char      stackName[STACK_NAME_LENGTH];
+        char     *attrName = stackName;
+        jsize     length   = (*env)->GetArrayLength(env, name);
+        PyObject *attr;
+
+        if (length > STACK_NAME_LENGTH) {
+            attrName = malloc(length);
+            if (!attrName) {
+                THROW_JEP(env, "Out of memory");
+                return NULL;
+            }
         }
-        attrName = (*env)->GetStringUTFChars(env, name, 0);
+        (*env)->GetByteArrayRegion(env, name, 0, length, (jbyte*) attrName);
         PyEval_AcquireThread(jepThread->tstate);
-        if (abstract || PyObject_HasAttrString(target, attrName)) {
-            PyObject *attr = PyObject_GetAttrString(target, attrName);
-            if (attr == NULL) {
-                process_py_exception(env);
-            } else {
-                result = pyembed_invoke_as(env, attr, args, NULL, retType);
-                Py_DecRef(attr);
-            }
+        attr = PyObject_GetAttrString(target, attrName);
+        if (attr) {
+            result = pyembed_invoke_as(env, attr, args, NULL, retType);
+            Py_DECREF(attr);
+        } else if (!abstract && PyErr_ExceptionMatches(PyExc_AttributeError)) {
+            PyErr_Clear();
+            result = invokeDefault(env, obj, args, interface,
+                                   (jmethodID) (intptr_t) methodID,
+                                   parameterTypes, primitiveRetType);
         } else {
-            result = invokeDefault(env, obj, method, args);
+            process_py_exception(env);
         }
         PyEval_ReleaseThread(jepThread->tstate);
-        (*env)->ReleaseStringUTFChars(env, name, attrName);
+        if (attrName != stackName) {
+            free(attrName);
+        }
     }
 
     return result;
 }
-
-
@@ -62,6 +62,9 @@ PyObject* pyjarray_new(JNIEnv *env, jobjectArray obj)
     pyarray->componentClass         = NULL;
     pyarray->length                 = -1;
     pyarray->pinnedArray            = NULL;
+    pyarray->exports                = 0;
+    pyarray->dirty                  = 0;
+    pyarray->stale                  = 0;
 
     if (pyjarray_init(env, pyarray, 0, NULL)) {
         return (PyObject *) pyarray;
@@ -270,6 +273,9 @@ PyObject* pyjarray_new_v(PyObject *isnull, PyObject *args)
     pyarray->componentClass         = NULL;
     pyarray->length                 = -1;
     pyarray->pinnedArray            = NULL;
+    pyarray->exports                = 0;
+    pyarray->dirty                  = 0;
+    pyarray->stale                  = 0;
 
     if (typeId == JOBJECT_ID || typeId == JARRAY_ID) {
         pyarray->componentClass = (*env)->NewGlobalRef(env, componentClass);
@@ -470,6 +476,8 @@ static int pyjarray_init(JNIEnv *env,
         }
 
         } // switch
+
+        pyarray->dirty = 1;
     } // if zero
 
     (*env)->DeleteLocalRef(env, compType);
@@ -488,11 +496,206 @@ EXIT_ERROR:
 }
 
 
+// struct module format of the elements of primitive arrays
+static const char* pyjarray_buffer_format(int componentType, Py_ssize_t *itemsize)
+{
+    switch (componentType) {
+    case JBOOLEAN_ID:
+        *itemsize = sizeof(jboolean);
+        return "?";
+    case JBYTE_ID:
+        *itemsize = sizeof(jbyte);
+        return "b";
+    case JCHAR_ID:
+        *itemsize = sizeof(jchar);
+        return "H";
+    case JSHORT_ID:
+        *itemsize = sizeof(jshort);
+        return "h";
+    case JINT_ID:
+        *itemsize = sizeof(jint);
+        return "i";
+    case JLONG_ID:
+        *itemsize = sizeof(jlong);
+        return "q";
+    case JFLOAT_ID:
+        *itemsize = sizeof(jfloat);
+        return "f";
+    case JDOUBLE_ID:
+        *itemsize = sizeof(jdouble);
+        return "d";
+    }
+    return NULL;
+}
+
+
+// copy part of a primitive java array into buf
+static void pyjarray_get_region(JNIEnv *env, PyJArrayObject *self,
+                                jsize start, jsize len, void *buf)
+{
+    switch (self->componentType) {
+
+    case JINT_ID:
+        (*env)->GetIntArrayRegion(env, self->object, start, len,
+                                  (jint *) buf);
+        break;
+
+    case JCHAR_ID:
+        (*env)->GetCharArrayRegion(env, self->object, start, len,
+                                   (jchar *) buf);
+        break;
+
+    case JBYTE_ID:
+        (*env)->GetByteArrayRegion(env, self->object, start, len,
+                                   (jbyte *) buf);
+        break;
+
+    case JLONG_ID:
+        (*env)->GetLongArrayRegion(env, self->object, start, len,
+                                   (jlong *) buf);
+        break;
+
+    case JBOOLEAN_ID:
+        (*env)->GetBooleanArrayRegion(env, self->object, start, len,
+                                      (jboolean *) buf);
+        break;
+
+    case JDOUBLE_ID:
+        (*env)->GetDoubleArrayRegion(env, self->object, start, len,
+                                     (jdouble *) buf);
+        break;
+
+    case JSHORT_ID:
+        (*env)->GetShortArrayRegion(env, self->object, start, len,
+                                    (jshort *) buf);
+        break;
+
+    case JFLOAT_ID:
+        (*env)->GetFloatArrayRegion(env, self->object, start, len,
+                                    (jfloat *) buf);
+        break;
+
+    } // switch
+}
+
+
+// copy buf into part of a primitive java array
+static void pyjarray_set_region(JNIEnv *env, PyJArrayObject *self,
+                                jsize start, jsize len, void *buf)
+{
+    switch (self->componentType) {
+
+    case JINT_ID:
+        (*env)->SetIntArrayRegion(env, self->object, start, len,
+                                  (const jint *) buf);
+        break;
+
+    case JCHAR_ID:
+        (*env)->SetCharArrayRegion(env, self->object, start, len,
+                                   (const jchar *) buf);
+        break;
+
+    case JBYTE_ID:
+        (*env)->SetByteArrayRegion(env, self->object, start, len,
+                                   (const jbyte *) buf);
+        break;
+
+    case JLONG_ID:
+        (*env)->SetLongArrayRegion(env, self->object, start, len,
+                                   (const jlong *) buf);
+        break;
+
+    case JBOOLEAN_ID:
+        (*env)->SetBooleanArrayRegion(env, self->object, start, len,
+                                      (const jboolean *) buf);
+        break;
+
+    case JDOUBLE_ID:
+        (*env)->SetDoubleArrayRegion(env, self->object, start, len,
+                                     (const jdouble *) buf);
+        break;
+
+    case JSHORT_ID:
+        (*env)->SetShortArrayRegion(env, self->object, start, len,
+                                    (const jshort *) buf);
+        break;
+
+    case JFLOAT_ID:
+        (*env)->SetFloatArrayRegion(env, self->object, start, len,
+                                    (const jfloat *) buf);
+        break;
+
+    } // switch
+}
+
+
+// copy the java array into an already pinned copy. NOOP if the pinned
+// array is the raw data.
+static void pyjarray_refresh_pinned(JNIEnv *env, PyJArrayObject *self)
+{
+    if (self->isCopy) {
+        pyjarray_get_region(env, self, 0, self->length, self->pinnedArray);
+    }
+}
+
+
+// copy elements of a primitive array into buf
+static void pyjarray_copy_region(JNIEnv *env, PyJArrayObject *self,
+                                 jsize start, jsize len, void *buf)
+{
+    Py_ssize_t itemsize;
+
+    if (self->stale) {
+        // java has the data, only copy the region out of it
+        pyjarray_get_region(env, self, start, len, buf);
+    } else {
+        pyjarray_buffer_format(self->componentType, &itemsize);
+        memcpy(buf, ((char *) self->pinnedArray) + start * itemsize,
+               len * itemsize);
+    }
+}
+
+
+/*
+ * Java may have modified the array since it was pinned, copy it again before
+ * python uses the pinned array.
+ */
+static int pyjarray_refresh(PyJArrayObject *self)
+{
+    if (self->stale) {
+        JNIEnv *env = pyembed_get_env();
+
+        pyjarray_refresh_pinned(env, self);
+        if (process_java_exception(env)) {
+            return -1;
+        }
+        self->stale = 0;
+    }
+    return 0;
+}
+
+
 // pin primitive array memory. NOOP for object arrays.
 void pyjarray_pin(PyJArrayObject *self)
 {
     JNIEnv *env = pyembed_get_env();
 
+    /*
+     * Already pinned, e.g. after a commit for a java call. Getting the
+     * elements again would leak the old copy and move the memory that is
+     * exported through the buffer protocol. Exported memory is updated in
+     * place, otherwise the copy is only updated when python uses it.
+     */
+    if (self->pinnedArray) {
+        if (self->exports) {
+            pyjarray_refresh_pinned(env, self);
+            process_java_exception(env);
+        } else if (self->isCopy) {
+            self->stale = 1;
+        }
+        return;
+    }
+
     switch (self->componentType) {
 
     case JINT_ID:
@@ -587,6 +790,15 @@ void pyjarray_release_pinned(PyJArrayObject *self, jint mode)
         return;
     }
 
+    // nothing to commit unless python wrote to the copy
+    if (self->isCopy && mode == JNI_COMMIT && !self->dirty) {
+        return;
+    }
+    // an exported buffer can still be written after this commit
+    if (mode == JNI_COMMIT && !self->exports) {
+        self->dirty = 0;
+    }
+
     switch (self->componentType) {
 
     case JINT_ID:
@@ -748,6 +960,10 @@ static int pyjarray_setitem(PyJArrayObject *self,
         PyErr_SetString(PyExc_RuntimeError, "Pinned array shouldn't be null.");
         return -1;
     }
+    if (pyjarray_refresh(self)) {
+        return -1;
+    }
+    self->dirty = 1;
 
     switch (self->componentType) {
 
@@ -859,6 +1075,9 @@ static PyObject* pyjarray_item(PyJArrayObject *self, Py_ssize_t pos)
     if (pos >= self->length) {
         pos = self->length - 1;
     }
+    if (pyjarray_refresh(self)) {
+        return NULL;
+    }
 
     switch (self->componentType) {
 
@@ -970,6 +1189,10 @@ static int pyjarray_index(PyJArrayObject *self, PyObject *el)
 {
     JNIEnv *env = pyembed_get_env();
 
+    if (pyjarray_refresh(self)) {
+        return -1;
+    }
+
     switch (self->componentType) {
 
     case JSTRING_ID: {
@@ -1367,153 +1590,52 @@ static PyObject* pyjarray_slice(PyObject *_self, Py_ssize_t ilow,
 
         break;
 
-    case JINT_ID: {
-        jint *ar, *src;
+    case JINT_ID:
         arrayObj = (*env)->NewIntArray(env, (jsize) len);
-        pyarray  = (PyJArrayObject *) pyjarray_new(env, arrayObj);
-        if (PyErr_Occurred()) {
-            break;
-        }
-
-        ar  = (jint *) pyarray->pinnedArray;
-        src = (jint *) self->pinnedArray;
-        for (i = 0; i < len; i++) {
-            ar[i] = src[ilow++];
-        }
-
-        ret = (PyObject *) pyarray;
         break;
-    }
 
-    case JBYTE_ID: {
-        jbyte *ar, *src;
+    case JBYTE_ID:
         arrayObj = (*env)->NewByteArray(env, (jsize) len);
-        pyarray  = (PyJArrayObject *) pyjarray_new(env, arrayObj);
-        if (PyErr_Occurred()) {
-            break;
-        }
-
-        ar  = (jbyte *) pyarray->pinnedArray;
-        src = (jbyte *) self->pinnedArray;
-        for (i = 0; i < len; i++) {
-            ar[i] = src[ilow++];
-        }
-
-        ret = (PyObject *) pyarray;
         break;
-    }
 
-    case JCHAR_ID: {
-        jchar *ar, *src;
+    case JCHAR_ID:
         arrayObj = (*env)->NewCharArray(env, (jsize) len);
-        pyarray  = (PyJArrayObject *) pyjarray_new(env, arrayObj);
-        if (PyErr_Occurred()) {
-            break;
-        }
-
-        ar  = (jchar *) pyarray->pinnedArray;
-        src = (jchar *) self->pinnedArray;
-        for (i = 0; i < len; i++) {
-            ar[i] = src[ilow++];
-        }
-
-        ret = (PyObject *) pyarray;
         break;
-    }
 
-    case JLONG_ID: {
-        jlong *ar, *src;
+    case JLONG_ID:
         arrayObj = (*env)->NewLongArray(env, (jsize) len);
-        pyarray  = (PyJArrayObject *) pyjarray_new(env, arrayObj);
-        if (PyErr_Occurred()) {
-            break;
-        }
-
-        ar  = (jlong *) pyarray->pinnedArray;
-        src = (jlong *) self->pinnedArray;
-        for (i = 0; i < len; i++) {
-            ar[i] = src[ilow++];
-        }
-
-        ret = (PyObject *) pyarray;
         break;
-    }
 
-    case JBOOLEAN_ID: {
-        jboolean *ar, *src;
+    case JBOOLEAN_ID:
         arrayObj = (*env)->NewBooleanArray(env, (jsize) len);
-        pyarray  = (PyJArrayObject *) pyjarray_new(env, arrayObj);
-        if (PyErr_Occurred()) {
-            break;
-        }
-
-        ar  = (jboolean *) pyarray->pinnedArray;
-        src = (jboolean *) self->pinnedArray;
-        for (i = 0; i < len; i++) {
-            ar[i] = src[ilow++];
-        }
-
-        ret = (PyObject *) pyarray;
         break;
-    }
 
-    case JDOUBLE_ID: {
-        jdouble *ar, *src;
+    case JDOUBLE_ID:
         arrayObj = (*env)->NewDoubleArray(env, (jsize) len);
-        pyarray  = (PyJArrayObject *) pyjarray_new(env, arrayObj);
-        if (PyErr_Occurred()) {
-            break;
-        }
-
-        ar  = (jdouble *) pyarray->pinnedArray;
-        src = (jdouble *) self->pinnedArray;
-        for (i = 0; i < len; i++) {
-            ar[i] = src[ilow++];
-        }
-
-        ret = (PyObject *) pyarray;
         break;
-    }
 
-    case JSHORT_ID: {
-        jshort *ar, *src;
+    case JSHORT_ID:
         arrayObj = (*env)->NewShortArray(env, (jsize) len);
-        pyarray  = (PyJArrayObject *) pyjarray_new(env, arrayObj);
-        if (PyErr_Occurred()) {
-            break;
-        }
-
-        ar  = (jshort *) pyarray->pinnedArray;
-        src = (jshort *) self->pinnedArray;
-        for (i = 0; i < len; i++) {
-            ar[i] = src[ilow++];
-        }
-
-        ret = (PyObject *) pyarray;
         break;
-    }
 
-    case JFLOAT_ID: {
-        jfloat *ar, *src;
+    case JFLOAT_ID:
         arrayObj = (*env)->NewFloatArray(env, (jsize) len);
-        pyarray  = (PyJArrayObject *) pyjarray_new(env, arrayObj);
-        if (PyErr_Occurred()) {
-            break;
-        }
-
-        ar  = (jfloat *) pyarray->pinnedArray;
-        src = (jfloat *) self->pinnedArray;
-        for (i = 0; i < len; i++) {
-            ar[i] = src[ilow++];
-        }
-
-        ret = (PyObject *) pyarray;
         break;
-    }
 
     } // switch
 
-    if (self->componentType == JOBJECT_ID ||
+    if (self->pinnedArray) {
+        pyarray = (PyJArrayObject *) pyjarray_new(env, arrayObj);
+        if (pyarray) {
+            pyjarray_copy_region(env, self, (jsize) ilow, (jsize) len,
+                                 pyarray->pinnedArray);
+            pyarray->dirty = 1;
+            ret = (PyObject *) pyarray;
+            if (process_java_exception(env)) {
+                Py_CLEAR(ret);
+            }
+        }
+    } else if (self->componentType == JOBJECT_ID ||
             self->componentType == JSTRING_ID ||
             self->componentType == JARRAY_ID) {
 
@@ -1583,6 +1705,304 @@ static PyObject* pyjarray_subscript(PyJArrayObject *self, PyObject *item)
 }
 
 
+// -------------------------------------------------- buffer protocol
+
+static int pyjarray_getbuffer(PyJArrayObject *self, Py_buffer *view, int flags)
+{
+    const char *format;
+    Py_ssize_t  itemsize;
+
+    format = pyjarray_buffer_format(self->componentType, &itemsize);
+    if (!format) {
+        PyErr_SetString(PyExc_BufferError,
+                        "Only arrays of primitive types support the buffer protocol");
+        view->obj = NULL;
+        return -1;
+    }
+    if (!self->pinnedArray) {
+        PyErr_SetString(PyExc_BufferError, "Array is not pinned");
+        view->obj = NULL;
+        return -1;
+    }
+    if (pyjarray_refresh(self)) {
+        view->obj = NULL;
+        return -1;
+    }
+
+    self->exportShape = self->length;
+
+    view->buf        = self->pinnedArray;
+    view->obj        = (PyObject*) self;
+    Py_INCREF(self);
+    view->len        = self->exportShape * itemsize;
+    view->readonly   = 0;
+    view->itemsize   = itemsize;
+    view->format     = (flags & PyBUF_FORMAT) ? (char*) format : NULL;
+    view->ndim       = 1;
+    view->shape      = (flags & PyBUF_ND) ? &(self->exportShape) : NULL;
+    view->strides    = ((flags & PyBUF_STRIDES) == PyBUF_STRIDES) ? &(view->itemsize) : NULL;
+    view->suboffsets = NULL;
+    view->internal   = NULL;
+
+    // the view is writable so the copy must be committed when it is released
+    self->exports++;
+    self->dirty = 1;
+    return 0;
+}
+
+
+// writes through a writable view are committed when the view is released
+static void pyjarray_releasebuffer(PyJArrayObject *self, Py_buffer *view)
+{
+    self->exports--;
+    if (!view->readonly) {
+        pyjarray_release_pinned(self, JNI_COMMIT);
+    }
+}
+
+
+static PyBufferProcs pyjarray_as_buffer = {
+    (getbufferproc) pyjarray_getbuffer,       /* bf_getbuffer */
+    (releasebufferproc) pyjarray_releasebuffer, /* bf_releasebuffer */
+};
+
+
+// -------------------------------------------------- bulk copies
+
+// check that a buffer holds elements of a primitive type
+static int pyjarray_check_format(int componentType, Py_buffer *view)
+{
+    const char *expected;
+    const char *format;
+    Py_ssize_t  itemsize;
+    char        order = '@';
+    int         match = 0;
+
+    expected = pyjarray_buffer_format(componentType, &itemsize);
+    if (!expected) {
+        PyErr_SetString(PyExc_TypeError,
+                        "Only arrays of primitive types can be copied with buffers");
+        return -1;
+    }
+
+    format = view->format ? view->format : "B";
+    if (strchr("@=<>!", format[0])) {
+        order = *format++;
+    }
+#if PY_LITTLE_ENDIAN
+    if (order == '>' || order == '!') {
+#else
+    if (order == '<') {
+#endif
+        PyErr_Format(PyExc_ValueError,
+                     "Buffer format '%s' does not have the native byte order",
+                     view->format);
+        return -1;
+    }
+
+    if (format[0] && !format[1] && view->itemsize == itemsize) {
+        switch (componentType) {
+        case JBYTE_ID:
+            match = strchr("bBc", format[0]) != NULL;
+            break;
+        case JINT_ID:
+        case JLONG_ID:
+            match = strchr("ilqn", format[0]) != NULL;
+            break;
+        default:
+            match = format[0] == expected[0];
+        }
+    }
+    if (!match) {
+        PyErr_Format(PyExc_ValueError,
+                     "Buffer format '%s' does not match the array format '%s'",
+                     view->format ? view->format : "B", expected);
+        return -1;
+    }
+    return 0;
+}
+
+
+// check that a buffer holds elements of the primitive type of the array
+static int pyjarray_check_buffer(PyJArrayObject *self, Py_buffer *view)
+{
+    if (!self->pinnedArray) {
+        PyErr_SetString(PyExc_TypeError,
+                        "Only arrays of primitive types can be copied with buffers");
+        return -1;
+    }
+    return pyjarray_check_format(self->componentType, view);
+}
+
+
+// find the primitive type id for the type argument of jarrayFromBuffer,
+// which is a type id, a typecode or a primitive class. -1 for other types.
+static int pyjarray_primitive_type(JNIEnv *env, PyObject *type)
+{
+    static const char typecodes[] = "zbcsijfd";
+    const int typeIds[] = {JBOOLEAN_ID, JBYTE_ID, JCHAR_ID, JSHORT_ID,
+                           JINT_ID, JLONG_ID, JFLOAT_ID, JDOUBLE_ID
+                          };
+    const jclass classes[] = {JBOOLEAN_TYPE, JBYTE_TYPE, JCHAR_TYPE, JSHORT_TYPE,
+                              JINT_TYPE, JLONG_TYPE, JFLOAT_TYPE, JDOUBLE_TYPE
+                             };
+    int i;
+
+    if (PyLong_Check(type)) {
+        return (int) PyLong_AsLong(type);
+    } else if (PyUnicode_Check(type)) {
+        if (PyUnicode_GET_LENGTH(type) == 1) {
+            Py_UCS4 typecode = PyUnicode_READ_CHAR(type, 0);
+            for (i = 0; typecodes[i]; i++) {
+                if (typecodes[i] == typecode) {
+                    return typeIds[i];
+                }
+            }
+        }
+    } else if (PyJObject_Check(type)) {
+        for (i = 0; typecodes[i]; i++) {
+            if ((*env)->IsSameObject(env, ((PyJObject*) type)->clazz, classes[i])) {
+                return typeIds[i];
+            }
+        }
+    }
+    return -1;
+}
+
+
+// check that a buffer fits in the array at offset
+static int pyjarray_check_region(PyJArrayObject *self, Py_buffer *view,
+                                 Py_ssize_t offset)
+{
+    if (offset < 0 || offset > self->length
+            || view->len / view->itemsize > self->length - offset) {
+        PyErr_Format(PyExc_IndexError,
+                     "%zd elements at offset %zd are out of range for array of length %i",
+                     view->len / view->itemsize, offset, self->length);
+        return -1;
+    }
+    return 0;
+}
+
+
+static PyObject* pyjarray_copy_from(PyJArrayObject *self, PyObject *args)
+{
+    PyObject  *obj;
+    Py_buffer  view;
+    Py_ssize_t offset = 0;
+    jsize      len;
+    JNIEnv    *env    = pyembed_get_env();
+
+    if (!PyArg_ParseTuple(args, "O|n:copyFrom", &obj, &offset)) {
+        return NULL;
+    }
+    if (PyObject_GetBuffer(obj, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0) {
+        return NULL;
+    }
+    if (pyjarray_check_buffer(self, &view) || pyjarray_check_region(self, &view, offset)) {
+        PyBuffer_Release(&view);
+        return NULL;
+    }
+
+    len = (jsize) (view.len / view.itemsize);
+    if (self->stale) {
+        // the copy is updated from java when it is used
+        pyjarray_set_region(env, self, (jsize) offset, len, view.buf);
+    } else {
+        memcpy(((char *) self->pinnedArray) + offset * view.itemsize, view.buf,
+               view.len);
+        // keep a clean copy clean, a dirty copy is committed later
+        if (self->isCopy && !self->dirty && !self->exports) {
+            pyjarray_set_region(env, self, (jsize) offset, len, view.buf);
+        }
+    }
+    PyBuffer_Release(&view);
+
+    if (process_java_exception(env)) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+
+static PyObject* pyjarray_copy_into(PyJArrayObject *self, PyObject *args)
+{
+    PyObject  *obj;
+    Py_buffer  view;
+    Py_ssize_t offset = 0;
+    JNIEnv    *env    = pyembed_get_env();
+
+    if (!PyArg_ParseTuple(args, "O|n:copyInto", &obj, &offset)) {
+        return NULL;
+    }
+    if (PyObject_GetBuffer(obj, &view,
+                           PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | PyBUF_WRITABLE) < 0) {
+        return NULL;
+    }
+    if (pyjarray_check_buffer(self, &view) || pyjarray_check_region(self, &view, offset)) {
+        PyBuffer_Release(&view);
+        return NULL;
+    }
+
+    pyjarray_copy_region(env, self, (jsize) offset,
+                         (jsize) (view.len / view.itemsize), view.buf);
+    PyBuffer_Release(&view);
+
+    if (process_java_exception(env)) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+
+// called from module to create a new array with the contents of a buffer.
+PyObject* pyjarray_from_buffer(PyObject *isnull, PyObject *args)
+{
+    PyObject       *obj, *type;
+    PyObject       *sizeArgs;
+    PyJArrayObject *pyarray;
+    Py_buffer       view;
+    int             typeId;
+
+    if (!PyArg_ParseTuple(args, "OO:jarrayFromBuffer", &obj, &type)) {
+        return NULL;
+    }
+    if (PyObject_GetBuffer(obj, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0) {
+        return NULL;
+    }
+    if (view.itemsize < 1 || view.len / view.itemsize > INT_MAX) {
+        PyErr_SetString(PyExc_ValueError, "Buffer is too large for a Java array");
+        PyBuffer_Release(&view);
+        return NULL;
+    }
+    // check the format before allocating the array
+    typeId = pyjarray_primitive_type(pyembed_get_env(), type);
+    if ((typeId == -1 && PyErr_Occurred())
+            || pyjarray_check_format(typeId, &view)) {
+        PyBuffer_Release(&view);
+        return NULL;
+    }
+
+    sizeArgs = Py_BuildValue("(nO)", view.len / view.itemsize, type);
+    if (!sizeArgs) {
+        PyBuffer_Release(&view);
+        return NULL;
+    }
+    pyarray = (PyJArrayObject *) pyjarray_new_v(NULL, sizeArgs);
+    Py_DECREF(sizeArgs);
+    if (!pyarray || pyjarray_check_buffer(pyarray, &view)) {
+        Py_XDECREF(pyarray);
+        PyBuffer_Release(&view);
+        return NULL;
+    }
+
+    memcpy(pyarray->pinnedArray, view.buf, view.len);
+    pyarray->dirty = 1;
+    PyBuffer_Release(&view);
+    return (PyObject *) pyarray;
+}
+
+
 static PyObject* pyjarray_str(PyJArrayObject *self)
 {
     PyObject *ret;
@@ -1612,6 +2032,10 @@ PyDoc_STRVAR(index_doc,
              "L.index(value) -> integer -- return first index of value");
 PyDoc_STRVAR(commit_doc,
              "x.commit() -- commit pinned array to Java memory");
+PyDoc_STRVAR(copy_from_doc,
+             "x.copyFrom(buffer, [offset]) -- copy the elements of a buffer into the array at offset");
+PyDoc_STRVAR(copy_into_doc,
+             "x.copyInto(buffer, [offset]) -- fill a writable buffer with the elements of the array from offset");
 
 PyMethodDef pyjarray_methods[] = {
     {
@@ -1623,6 +2047,10 @@ PyMethodDef pyjarray_methods[] = {
 
     {"commit", (PyCFunction) pyjarray_commit, METH_VARARGS, commit_doc},
 
+    {"copyFrom", (PyCFunction) pyjarray_copy_from, METH_VARARGS, copy_from_doc},
+
+    {"copyInto", (PyCFunction) pyjarray_copy_into, METH_VARARGS, copy_into_doc},
+
     { NULL, NULL }
 };
 
@@ -1669,7 +2097,7 @@ PyTypeObject PyJArray_Type = {
     (reprfunc) pyjarray_str,                  /* tp_str */
     0,                                        /* tp_getattro */
     0,                                        /* tp_setattro */
-    0,                                        /* tp_as_buffer */
+    &pyjarray_as_buffer,                      /* tp_as_buffer */
     Py_TPFLAGS_DEFAULT,                       /* tp_flags */
     list_doc,                                 /* tp_doc */
     0,                                        /* tp_traverse */
@@ -33,6 +33,11 @@
  */
 #include "structmember.h"
 
+#if JEP_VECTORCALL
+static PyObject* pyjclass_vectorcall(PyObject*, PyObject *const*, size_t,
+                                     PyObject*);
+#endif
+
 /*
  * Adds a single inner class as attributes to the pyjclass. This will check if
  * the inner class is public and will only add it if it is public. This is
@@ -186,6 +191,9 @@ static int pyjclass_init(JNIEnv *env, PyObject *pyobj)
     PyJClassObject *pyjclass = (PyJClassObject*) pyobj;
 
     pyjclass->constructor = NULL;
+#if JEP_VECTORCALL
+    pyjclass->vectorcall = pyjclass_vectorcall;
+#endif
     pyjclass->attr = pyjclass_init_attr(env, ((PyJObject*) pyobj)->clazz);
     if (pyjclass->attr == NULL) {
         return 0;
@@ -303,22 +311,36 @@ EXIT_ERROR:
     return -1;
 }
 
-// call constructor as a method and return pyjobject.
-static PyObject* pyjclass_call(PyJClassObject *self,
-                               PyObject *args,
-                               PyObject *keywords)
+/*
+ * Initialize the constructor field of a pyjclass if it has not been
+ * initialized yet.
+ *
+ * @return 1 if the constructor is available, -1 on error.
+ */
+static int pyjclass_check_constructor(PyJClassObject *self)
 {
-    PyObject *boundConstructor = NULL;
-    PyObject *result           = NULL;
     if (self->constructor == NULL) {
         if (pyjclass_init_constructors(self) == -1) {
-            return NULL;
+            return -1;
         }
         if (self->constructor == NULL) {
             PyErr_Format(PyExc_TypeError, "No public constructor");
-            return NULL;
+            return -1;
         }
     }
+    return 1;
+}
+
+// call constructor as a method and return pyjobject.
+static PyObject* pyjclass_call(PyJClassObject *self,
+                               PyObject *args,
+                               PyObject *keywords)
+{
+    PyObject *boundConstructor = NULL;
+    PyObject *result           = NULL;
+    if (pyjclass_check_constructor(self) == -1) {
+        return NULL;
+    }
     /*
      * Bind the constructor to the class so that the class will
      * be the first arg when constructor is called.
@@ -329,6 +351,65 @@ static PyObject* pyjclass_call(PyJClassObject *self,
     return result;
 }
 
+#if JEP_VECTORCALL
+/*
+ * The number of args that can be passed to a constructor before
+ * pyjclass_vectorcall needs to allocate memory to prepend the class.
+ */
+#define SMALL_ARGS_SIZE 8
+
+/*
+ * Call the constructor with the class prepended to the args. Unlike
+ * pyjclass_call this does not need to create a bound method or an args tuple.
+ */
+static PyObject* pyjclass_vectorcall(PyObject *self, PyObject *const *args,
+                                     size_t nargsf, PyObject *kwnames)
+{
+    PyJClassObject  *pyjclass                   = (PyJClassObject*) self;
+    Py_ssize_t       nargs                      = PyVectorcall_NARGS(nargsf);
+    Py_ssize_t       totalArgs                  = nargs;
+    PyObject        *smallArgs[SMALL_ARGS_SIZE];
+    PyObject       **newArgs                    = smallArgs;
+    PyObject        *result                     = NULL;
+
+    if (pyjclass_check_constructor(pyjclass) == -1) {
+        return NULL;
+    }
+
+    if (nargsf & PY_VECTORCALL_ARGUMENTS_OFFSET) {
+        /*
+         * The caller allows args[-1] to be temporarily replaced, which avoids
+         * copying the args.
+         */
+        PyObject **mutableArgs = (PyObject**) args - 1;
+        PyObject  *saved       = mutableArgs[0];
+        mutableArgs[0] = self;
+        result = PyObject_Vectorcall(pyjclass->constructor, mutableArgs, nargs + 1,
+                                     kwnames);
+        mutableArgs[0] = saved;
+        return result;
+    }
+
+    if (kwnames) {
+        totalArgs += PyTuple_GET_SIZE(kwnames);
+    }
+    if (totalArgs + 1 > SMALL_ARGS_SIZE) {
+        newArgs = PyMem_Malloc(sizeof(PyObject*) * (totalArgs + 1));
+        if (!newArgs) {
+            return PyErr_NoMemory();
+        }
+    }
+    newArgs[0] = self;
+    memcpy(newArgs + 1, args, sizeof(PyObject*) * totalArgs);
+    result = PyObject_Vectorcall(pyjclass->constructor, newArgs, nargs + 1,
+                                 kwnames);
+    if (newArgs != smallArgs) {
+        PyMem_Free(newArgs);
+    }
+    return result;
+}
+#endif
+
 // get attribute 'name' for object.
 // uses obj->attr dict for storage.
 // returns new reference.
@@ -464,7 +545,11 @@ PyTypeObject PyJClass_Type = {
     sizeof(PyJClassObject),
     0,
     (destructor) pyjclass_dealloc,            /* tp_dealloc */
+#if JEP_VECTORCALL
+    offsetof(PyJClassObject, vectorcall),     /* tp_vectorcall_offset */
+#else
     0,                                        /* tp_print */
+#endif
     0,                                        /* tp_getattr */
     0,                                        /* tp_setattr */
     0,                                        /* tp_compare */
@@ -478,7 +563,12 @@ PyTypeObject PyJClass_Type = {
     pyjclass_getattro,                        /* tp_getattro */
     pyjclass_setattro,                        /* tp_setattro */
     0,                                        /* tp_as_buffer */
+#if JEP_VECTORCALL
+    Py_TPFLAGS_DEFAULT |
+    Py_TPFLAGS_HAVE_VECTORCALL,               /* tp_flags */
+#else
     Py_TPFLAGS_DEFAULT,                       /* tp_flags */
+#endif
     "jclass",                                 /* tp_doc */
     0,                                        /* tp_traverse */
     0,                                        /* tp_clear */
@@ -34,6 +34,11 @@
  */
 static PyObject* initMethodName = NULL;
 
+#if JEP_VECTORCALL
+static PyObject* pyjconstructor_vectorcall(PyObject*, PyObject *const*, size_t,
+        PyObject*);
+#endif
+
 
 static int pyjconstructor_init(JNIEnv *env, PyJMethodObject *self)
 {
@@ -52,8 +57,6 @@ static int pyjconstructor_init(JNIEnv *env, PyJMethodObject *self)
         goto EXIT_ERROR;
     }
 
-    self->parameters    = (*env)->NewGlobalRef(env, paramArray);
-    self->lenParameters = (*env)->GetArrayLength(env, paramArray);
     jobject jpymethod = java_lang_reflect_AnnotatedElement_getAnnotation(env,
                         self->rmethod, JPYMETHOD_TYPE);
     if (jpymethod) {
@@ -65,6 +68,10 @@ static int pyjconstructor_init(JNIEnv *env, PyJMethodObject *self)
         if (process_java_exception(env)) {
             goto EXIT_ERROR;
         }
+        self->releaseGIL = jep_PyMethod_releaseGIL(env, jpymethod);
+        if (process_java_exception(env)) {
+            goto EXIT_ERROR;
+        }
     } else {
         if (process_java_exception(env)) {
             goto EXIT_ERROR;
@@ -75,6 +82,9 @@ static int pyjconstructor_init(JNIEnv *env, PyJMethodObject *self)
         }
         self->isKwArgs = 0;
     }
+    if (!PyJMethod_InitParameters(self, env, paramArray)) {
+        goto EXIT_ERROR;
+    }
     (*env)->PopLocalFrame(env, NULL);
     return 1;
 
@@ -100,10 +110,18 @@ PyObject* PyJConstructor_New(JNIEnv *env, jobject constructor)
 
     pym = PyObject_NEW(PyJMethodObject, &PyJConstructor_Type);
     pym->rmethod       = (*env)->NewGlobalRef(env, constructor);
-    pym->parameters    = NULL;
-    pym->lenParameters = 0;
+    pym->parameterTypes         = NULL;
+    pym->parameterTypeIds       = NULL;
+    pym->lenParameters          = -1;
+    pym->varArgsComponentType   = NULL;
+    pym->varArgsComponentTypeId = -1;
     pym->isStatic      = 1;
     pym->returnTypeId  = JOBJECT_ID;
+    pym->needsLocalFrame = 1;
+    pym->releaseGIL    = 1;
+#if JEP_VECTORCALL
+    pym->vectorcall    = pyjconstructor_vectorcall;
+#endif
     if (!initMethodName) {
         initMethodName = PyUnicode_FromString("<init>");
     }
@@ -137,11 +155,12 @@ int PyJConstructor_Check(PyObject* object)
  * here. Also ensure any changes here are done there if needed. If you
  * reading this and see a way to reduce the redundancy please do.
  */
-static PyObject* pyjconstructor_call(PyJMethodObject *self, PyObject *args,
-                                     PyObject *keywords)
+static PyObject* pyjconstructor_call_args(PyJMethodObject *self,
+        PyObject *const *args,
+        Py_ssize_t lenPyArgsGiven,
+        PyObject *keywords)
 {
     JNIEnv        *env              = NULL;
-    Py_ssize_t     lenPyArgsGiven   = 0;
     int            lenJArgsExpected = 0;
     /* The number of normal arguments before any varargs or kwargs */
     int            lenJArgsNormal   = 0;
@@ -160,7 +179,11 @@ static PyObject* pyjconstructor_call(PyJMethodObject *self, PyObject *args,
      */
     int            needToDoVarArgs  = 0;
 
-    lenPyArgsGiven = PyTuple_Size(args);
+    if (lenPyArgsGiven < 1) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "First argument to a java constructor must be a java class.");
+        return NULL;
+    }
 
     env = pyembed_get_env();
     lenJArgsExpected = PyJMethod_GetParameterCount(self, env);
@@ -189,7 +212,7 @@ static PyObject* pyjconstructor_call(PyJMethodObject *self, PyObject *args,
         return NULL;
     }
 
-    firstArg = PyTuple_GetItem(args, 0);
+    firstArg = args[0];
     if (!PyJClass_Check(firstArg)) {
         PyErr_SetString(PyExc_RuntimeError,
                         "First argument to a java constructor must be a java class.");
@@ -210,42 +233,32 @@ static PyObject* pyjconstructor_call(PyJMethodObject *self, PyObject *args,
     }
     for (pos = 0; pos < lenJArgsNormal; pos++) {
         PyObject *param = NULL;
-        int paramTypeId = -1;
-        jclass paramType = (jclass) (*env)->GetObjectArrayElement(env,
-                           self->parameters, pos);
+        int paramTypeId = self->parameterTypeIds[pos];
+        jclass paramType = self->parameterTypes[pos];
 
-        param = PyTuple_GetItem(args, pos + 1);
-        if (PyErr_Occurred()) {
-            goto EXIT_ERROR;
-        }
+        param = args[pos + 1];
 
-        paramTypeId = get_jtype(env, paramType);
         if (paramTypeId == JARRAY_ID) {
             foundArray = 1;
         }
 
         jargs[pos] = convert_pyarg_jvalue(env, param, paramType, paramTypeId, pos);
         if (PyErr_Occurred()) {
-            if (pos == (lenJArgsExpected - 1)
+            if (self->isVarArgs && pos == (lenJArgsExpected - 1)
                     && PyErr_ExceptionMatches(PyExc_TypeError)) {
-                if (self->isVarArgs) {
-                    /* Retry the last arg as array for varargs */
-                    PyErr_Clear();
-                    lenJArgsNormal -= 1;
-                    needToDoVarArgs = 1;
-                } else {
-                    goto EXIT_ERROR;
-                }
+                /* Retry the last arg as array for varargs */
+                PyErr_Clear();
+                lenJArgsNormal -= 1;
+                needToDoVarArgs = 1;
+            } else {
+                goto EXIT_ERROR;
             }
         }
-
-        (*env)->DeleteLocalRef(env, paramType);
     }
     if (needToDoVarArgs) {
         /* Need to process last arg as varargs. */
         PyObject *param = NULL;
-        jclass paramType = (jclass) (*env)->GetObjectArrayElement(env,
-                           self->parameters, lenJArgsNormal);
+        jclass paramType = self->parameterTypes[lenJArgsNormal];
         if (lenPyArgsGiven == (lenJArgsNormal + 1)) {
             /*
              * Python args are normally one longer than expected to allow for
@@ -253,7 +266,8 @@ static PyObject* pyjconstructor_call(PyJMethodObject *self, PyObject *args,
              */
             param = PyTuple_New(0);
         } else {
-            param = PyTuple_GetSlice(args, lenJArgsNormal + 1, lenPyArgsGiven);
+            param = pyargs_as_tuple(args + lenJArgsNormal + 1,
+                                    lenPyArgsGiven - lenJArgsNormal - 1);
         }
         if (PyErr_Occurred()) {
             goto EXIT_ERROR;
@@ -266,29 +280,26 @@ static PyObject* pyjconstructor_call(PyJMethodObject *self, PyObject *args,
         if (PyErr_Occurred()) {
             goto EXIT_ERROR;
         }
-        (*env)->DeleteLocalRef(env, paramType);
     }
     if (self->isKwArgs) {
         if (keywords) {
-            jclass paramType = (jclass) (*env)->GetObjectArrayElement(env,
-                               self->parameters, lenJArgsExpected - 1);
+            jclass paramType = self->parameterTypes[lenJArgsExpected - 1];
             jargs[lenJArgsExpected - 1] = convert_pyarg_jvalue(env, keywords, paramType,
                                           JOBJECT_ID, lenJArgsExpected - 1);
             if (PyErr_Occurred()) {
                 goto EXIT_ERROR;
             }
-            (*env)->DeleteLocalRef(env, paramType);
         } else {
             jargs[lenJArgsExpected - 1].l = NULL;
         }
     }
 
-    Py_BEGIN_ALLOW_THREADS;
+    JEP_BEGIN_ALLOW_THREADS_IF(self->releaseGIL);
     obj = (*env)->NewObjectA(env,
                              clazz->clazz,
                              self->methodId,
                              jargs);
-    Py_END_ALLOW_THREADS;
+    JEP_END_ALLOW_THREADS_IF;
     if (process_java_exception(env) || !obj) {
         goto EXIT_ERROR;
     }
@@ -303,7 +314,7 @@ static PyObject* pyjconstructor_call(PyJMethodObject *self, PyObject *args,
     // re pin array if needed
     if (foundArray) {
         for (pos = 0; pos < lenJArgsNormal; pos++) {
-            PyObject *param = PyTuple_GetItem(args, pos);
+            PyObject *param = args[pos + 1];
             if (param && pyjarray_check(param)) {
                 pyjarray_pin((PyJArrayObject *) param);
             }
@@ -319,6 +330,34 @@ EXIT_ERROR:
     return NULL;
 }
 
+static PyObject* pyjconstructor_call(PyJMethodObject *self, PyObject *args,
+                                     PyObject *keywords)
+{
+    return pyjconstructor_call_args(self, &PyTuple_GET_ITEM(args, 0),
+                                    PyTuple_GET_SIZE(args), keywords);
+}
+
+#if JEP_VECTORCALL
+static PyObject* pyjconstructor_vectorcall(PyObject *self,
+        PyObject *const *args, size_t nargsf, PyObject *kwnames)
+{
+    Py_ssize_t  nargs    = PyVectorcall_NARGS(nargsf);
+    PyObject   *keywords = NULL;
+    PyObject   *result   = NULL;
+
+    if (kwnames && PyTuple_GET_SIZE(kwnames) > 0) {
+        keywords = kwnames_as_dict(args + nargs, kwnames);
+        if (!keywords) {
+            return NULL;
+        }
+    }
+    result = pyjconstructor_call_args((PyJMethodObject*) self, args, nargs,
+                                      keywords);
+    Py_XDECREF(keywords);
+    return result;
+}
+#endif
+
 
 PyTypeObject PyJConstructor_Type = {
     PyVarObject_HEAD_INIT(NULL, 0)
@@ -326,7 +365,11 @@ PyTypeObject PyJConstructor_Type = {
     sizeof(PyJMethodObject),
     0,
     0,                                       /* tp_dealloc */
+#if JEP_VECTORCALL
+    offsetof(PyJMethodObject, vectorcall),    /* tp_vectorcall_offset */
+#else
     0,                                        /* tp_print */
+#endif
     0,                                        /* tp_getattr */
     0,                                        /* tp_setattr */
     0,                                        /* tp_compare */
@@ -340,7 +383,12 @@ PyTypeObject PyJConstructor_Type = {
     0,                                        /* tp_getattro */
     0,                                        /* tp_setattro */
     0,                                        /* tp_as_buffer */
+#if JEP_VECTORCALL
+    Py_TPFLAGS_DEFAULT |
+    Py_TPFLAGS_HAVE_VECTORCALL,               /* tp_flags */
+#else
     Py_TPFLAGS_DEFAULT,                       /* tp_flags */
+#endif
     "jconstructor",                           /* tp_doc */
     0,                                        /* tp_traverse */
     0,                                        /* tp_clear */
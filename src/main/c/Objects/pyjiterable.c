@@ -27,15 +27,43 @@
 
 #include "Jep.h"
 
+/*
+ * Iterator over a java.lang.Iterable that fetches the elements from the Java
+ * Iterator in chunks with jep.BulkConverter. The Java Iterator is not visible
+ * to Python so it does not matter that it is ahead of the Python iteration.
+ */
+typedef struct {
+    PyObject_HEAD
+    jobject     iter;       /* global ref, set to NULL when exhausted */
+    int         chunkSize;  /* number of elements in each chunk */
+    PyObject   *chunk;      /* Python list of the converted elements */
+    Py_ssize_t  chunkIndex; /* index in the chunk of the next element */
+    jthrowable  failure;    /* global ref, thrown after the chunk is used */
+} PyJIterableIterObject;
+
+/* The default number of elements in each chunk */
+#define ITERABLE_ITER_CHUNK 256
+
+static PyTypeObject PyJIterableIter_Type;
+
 /*
  * Gets the iterator for the object.
  */
-static PyObject* pyjiterable_getiter(PyObject* obj)
+PyObject* pyjiterable_getiter(PyObject* obj)
 {
-    jobject       iter     = NULL;
-    PyJObject    *pyjob    = (PyJObject*) obj;
-    JNIEnv       *env      = pyembed_get_env();
-    PyObject     *result   = NULL;
+    jobject                iter      = NULL;
+    PyJObject             *pyjob     = (PyJObject*) obj;
+    JNIEnv                *env       = pyembed_get_env();
+    PyObject              *result    = NULL;
+    JepModuleState        *state     = pyembed_get_module_state();
+    int                    chunkSize;
+    PyJIterableIterObject *it;
+
+    if (!state) {
+        return NULL;
+    }
+    chunkSize = state->iteratorChunkSize ? state->iteratorChunkSize :
+                ITERABLE_ITER_CHUNK;
 
     if ((*env)->PushLocalFrame(env, JLOCAL_REFS) != 0) {
         process_java_exception(env);
@@ -50,7 +78,24 @@ static PyObject* pyjiterable_getiter(PyObject* obj)
                         "java.lang.Iterable returned a null value from iterator()");
         goto FINALLY;
     }
-    result = jobject_As_PyObject(env, iter);
+    if (chunkSize == 1) {
+        result = jobject_As_PyObject(env, iter);
+        goto FINALLY;
+    }
+
+    if (PyType_Ready(&PyJIterableIter_Type) < 0) {
+        goto FINALLY;
+    }
+    it = PyObject_New(PyJIterableIterObject, &PyJIterableIter_Type);
+    if (!it) {
+        goto FINALLY;
+    }
+    it->iter       = (*env)->NewGlobalRef(env, iter);
+    it->chunkSize  = chunkSize;
+    it->chunk      = NULL;
+    it->chunkIndex = 0;
+    it->failure    = NULL;
+    result = (PyObject*) it;
 FINALLY:
     (*env)->PopLocalFrame(env, NULL);
     return result;
@@ -68,3 +113,123 @@ PyType_Spec PyJIterable_Spec = {
     .slots = slots
 };
 
+
+
+/*********************** Iterable Iterator **************************/
+
+static void pyjiterableiter_dealloc(PyJIterableIterObject *it)
+{
+#if USE_DEALLOC
+    JNIEnv *env = pyembed_get_env();
+    if (env && it->iter) {
+        (*env)->DeleteGlobalRef(env, it->iter);
+    }
+    if (env && it->failure) {
+        (*env)->DeleteGlobalRef(env, it->failure);
+    }
+    Py_XDECREF(it->chunk);
+    PyObject_Del(it);
+#endif
+}
+
+/*
+ * Replace the chunk with the next elements from the Java iterator. Returns 1
+ * if there are more elements, 0 if the iterator is exhausted and -1 if an
+ * error occurred.
+ *
+ * If the Java iterator throws an exception after some elements of a chunk
+ * were fetched, the exception is kept and raised when the chunk is used up,
+ * so Python sees the same elements as it would without chunks.
+ */
+static int pyjiterableiter_fill(PyJIterableIterObject *it)
+{
+    JNIEnv       *env = pyembed_get_env();
+    jobjectArray  failure;
+    jthrowable    pending;
+    jobject       values;
+
+    Py_CLEAR(it->chunk);
+    it->chunkIndex = 0;
+    if (it->failure) {
+        (*env)->Throw(env, it->failure);
+        (*env)->DeleteGlobalRef(env, it->failure);
+        it->failure = NULL;
+        process_java_exception(env);
+        return -1;
+    }
+    failure = (*env)->NewObjectArray(env, 1, JTHROWABLE_TYPE, NULL);
+    if (process_java_exception(env) || !failure) {
+        return -1;
+    }
+    values = jep_BulkConverter_next_Iterator_I_Throwable(env, it->iter,
+             it->chunkSize, failure);
+    if (process_java_exception(env) || !values) {
+        (*env)->DeleteLocalRef(env, failure);
+        return -1;
+    }
+    pending = (jthrowable) (*env)->GetObjectArrayElement(env, failure, 0);
+    if (pending) {
+        it->failure = (jthrowable) (*env)->NewGlobalRef(env, pending);
+        (*env)->DeleteLocalRef(env, pending);
+    }
+    (*env)->DeleteLocalRef(env, failure);
+    it->chunk = jvalues_As_PyList(env, values);
+    (*env)->DeleteLocalRef(env, values);
+    if (!it->chunk) {
+        return -1;
+    }
+    return PyList_GET_SIZE(it->chunk) > 0;
+}
+
+static PyObject* pyjiterableiter_next(PyJIterableIterObject *it)
+{
+    PyObject *item;
+
+    if (!it->iter) {
+        return NULL;
+    }
+    if (!it->chunk || it->chunkIndex >= PyList_GET_SIZE(it->chunk)) {
+        int more = pyjiterableiter_fill(it);
+        if (more <= 0) {
+            JNIEnv *env = pyembed_get_env();
+            (*env)->DeleteGlobalRef(env, it->iter);
+            it->iter = NULL;
+            Py_CLEAR(it->chunk);
+            return NULL;
+        }
+    }
+    item = PyList_GET_ITEM(it->chunk, it->chunkIndex);
+    it->chunkIndex += 1;
+    Py_INCREF(item);
+    return item;
+}
+
+static PyTypeObject PyJIterableIter_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "jep.PyJIterableIter",                    /* tp_name */
+    sizeof(PyJIterableIterObject),            /* tp_basicsize */
+    0,                                        /* tp_itemsize */
+    (destructor) pyjiterableiter_dealloc,     /* tp_dealloc */
+    0,                                        /* tp_print */
+    0,                                        /* tp_getattr */
+    0,                                        /* tp_setattr */
+    0,                                        /* tp_compare */
+    0,                                        /* tp_repr */
+    0,                                        /* tp_as_number */
+    0,                                        /* tp_as_sequence */
+    0,                                        /* tp_as_mapping */
+    0,                                        /* tp_hash */
+    0,                                        /* tp_call */
+    0,                                        /* tp_str */
+    0,                                        /* tp_getattro */
+    0,                                        /* tp_setattro */
+    0,                                        /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,                       /* tp_flags */
+    "Iterator over a java.lang.Iterable",     /* tp_doc */
+    0,                                        /* tp_traverse */
+    0,                                        /* tp_clear */
+    0,                                        /* tp_richcompare */
+    0,                                        /* tp_weaklistoffset */
+    PyObject_SelfIter,                        /* tp_iter */
+    (iternextfunc) pyjiterableiter_next,      /* tp_iternext */
+};
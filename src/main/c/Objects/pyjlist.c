@@ -35,6 +35,7 @@ static int pyjlist_setitem(PyObject*, Py_ssize_t, PyObject*);
 static int pyjlist_setslice(PyObject*, Py_ssize_t, Py_ssize_t, PyObject*);
 static PyObject* pyjlist_inplace_add(PyObject*, PyObject*);
 static PyObject* pyjlist_inplace_fill(PyObject*, Py_ssize_t);
+static PyObject* pyjlist_iter(PyObject*);
 
 /*
  * Convenience method to copy a list's items into a new java.util.List of the
@@ -445,8 +446,8 @@ static int pyjlist_set_subscript(PyObject* self, PyObject* item,
 }
 
 static PyType_Slot slots[] = {
-    // NOTE: Inherited `tp_iter` from PyJIterable
     {Py_tp_doc, "Jep java.util.List"},
+    {Py_tp_iter, (void*) pyjlist_iter},
     /*
      * **** sequence slots ****
      * NOTE: Inherited `sq_length` and `sq_contains` from PyJCollection
@@ -468,3 +469,158 @@ PyType_Spec PyJList_Spec = {
     .flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
     .slots = slots,
 };
+
+
+/*********************** List Iterator **************************/
+
+/*
+ * Iterator for lists that implement java.util.RandomAccess. Elements are
+ * fetched in chunks with jep.BulkConverter so a whole chunk crosses JNI in a
+ * single call. Chunks start small so a loop that exits early does not convert
+ * the entire list and then double in size up to LIST_ITER_MAX_CHUNK.
+ */
+#define LIST_ITER_MIN_CHUNK   16
+#define LIST_ITER_MAX_CHUNK 1024
+
+typedef struct {
+    PyObject_HEAD
+    PyJObject  *list;       /* Set to NULL when iterator is exhausted */
+    jint        size;       /* size of the list, -1 before the first chunk */
+    jint        index;      /* index in the list of the next chunk */
+    jint        chunkSize;  /* number of elements in the next chunk */
+    PyObject   *chunk;      /* Python list of the converted elements */
+    Py_ssize_t  chunkIndex; /* index in the chunk of the next element */
+} PyJListIterObject;
+
+static PyTypeObject PyJListIter_Type;
+
+static PyObject* pyjlist_iter(PyObject *self)
+{
+    PyJObject         *obj = (PyJObject*) self;
+    JNIEnv            *env = pyembed_get_env();
+    PyJListIterObject *it;
+
+    if (!(*env)->IsInstanceOf(env, obj->object, JRANDOMACCESS_TYPE)) {
+        /* Getting chunks by index is slow for other lists, like LinkedList */
+        return pyjiterable_getiter(self);
+    }
+    if (PyType_Ready(&PyJListIter_Type) < 0) {
+        return NULL;
+    }
+    it = PyObject_New(PyJListIterObject, &PyJListIter_Type);
+    if (!it) {
+        return NULL;
+    }
+    Py_INCREF(self);
+    it->list       = obj;
+    it->size       = -1;
+    it->index      = 0;
+    it->chunkSize  = LIST_ITER_MIN_CHUNK;
+    it->chunk      = NULL;
+    it->chunkIndex = 0;
+    return (PyObject*) it;
+}
+
+static void pyjlistiter_dealloc(PyJListIterObject *it)
+{
+    Py_XDECREF(it->list);
+    Py_XDECREF(it->chunk);
+    PyObject_Del(it);
+}
+
+/*
+ * Replace the chunk with the next elements of the list. Returns 1 if there
+ * are more elements, 0 if the end of the list was reached and -1 if an error
+ * occurred. Like the Java iterator this fails if the list is modified during
+ * iteration, which is detected by a change in the size of the list.
+ */
+static int pyjlistiter_fill(PyJListIterObject *it)
+{
+    JNIEnv  *env    = pyembed_get_env();
+    jobject  values = NULL;
+    jint     size;
+    jint     end;
+
+    Py_CLEAR(it->chunk);
+    it->chunkIndex = 0;
+
+    size = java_util_Collection_size(env, it->list->object);
+    if (process_java_exception(env)) {
+        return -1;
+    } else if (it->size >= 0 && size != it->size) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "java.util.List changed size during iteration");
+        return -1;
+    }
+    it->size = size;
+    if (it->index >= size) {
+        return 0;
+    }
+    end = size - it->index > it->chunkSize ? it->index + it->chunkSize : size;
+
+    values = jep_BulkConverter_toArray_List_I_I(env, it->list->object, it->index,
+             end);
+    if (process_java_exception(env) || !values) {
+        return -1;
+    }
+    it->chunk = jvalues_As_PyList(env, values);
+    (*env)->DeleteLocalRef(env, values);
+    if (!it->chunk) {
+        return -1;
+    }
+    it->index = end;
+    if (it->chunkSize < LIST_ITER_MAX_CHUNK) {
+        it->chunkSize *= 2;
+    }
+    return 1;
+}
+
+static PyObject* pyjlistiter_next(PyJListIterObject *it)
+{
+    PyObject *item;
+
+    if (!it->list) {
+        return NULL;
+    }
+    if (!it->chunk || it->chunkIndex >= PyList_GET_SIZE(it->chunk)) {
+        int more = pyjlistiter_fill(it);
+        if (more <= 0) {
+            Py_CLEAR(it->list);
+            return NULL;
+        }
+    }
+    item = PyList_GET_ITEM(it->chunk, it->chunkIndex);
+    it->chunkIndex += 1;
+    Py_INCREF(item);
+    return item;
+}
+
+static PyTypeObject PyJListIter_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "jep.PyJListIter",                        /* tp_name */
+    sizeof(PyJListIterObject),                /* tp_basicsize */
+    0,                                        /* tp_itemsize */
+    (destructor) pyjlistiter_dealloc,         /* tp_dealloc */
+    0,                                        /* tp_print */
+    0,                                        /* tp_getattr */
+    0,                                        /* tp_setattr */
+    0,                                        /* tp_compare */
+    0,                                        /* tp_repr */
+    0,                                        /* tp_as_number */
+    0,                                        /* tp_as_sequence */
+    0,                                        /* tp_as_mapping */
+    0,                                        /* tp_hash */
+    0,                                        /* tp_call */
+    0,                                        /* tp_str */
+    0,                                        /* tp_getattro */
+    0,                                        /* tp_setattro */
+    0,                                        /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,                       /* tp_flags */
+    "Iterator over a java.util.List",         /* tp_doc */
+    0,                                        /* tp_traverse */
+    0,                                        /* tp_clear */
+    0,                                        /* tp_richcompare */
+    0,                                        /* tp_weaklistoffset */
+    PyObject_SelfIter,                        /* tp_iter */
+    (iternextfunc) pyjlistiter_next,          /* tp_iternext */
+};
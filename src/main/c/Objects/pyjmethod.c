@@ -33,6 +33,13 @@
  */
 #include "structmember.h"
 
+/* calls with up to this many arguments convert them into a stack array */
+#define STACK_JARGS 4
+
+#if JEP_VECTORCALL
+static PyObject* pyjmethod_vectorcall(PyObject*, PyObject *const*, size_t,
+                                      PyObject*);
+#endif
 
 // called internally to make new PyJMethodObject instances.
 // throws python exception and returns NULL on error.
@@ -55,15 +62,64 @@ PyJMethodObject* PyJMethod_New(JNIEnv *env, jobject rmethod)
 
     pym                = PyObject_NEW(PyJMethodObject, &PyJMethod_Type);
     pym->rmethod       = (*env)->NewGlobalRef(env, rmethod);
-    pym->parameters    = NULL;
-    pym->lenParameters = -1;
+    pym->parameterTypes         = NULL;
+    pym->parameterTypeIds       = NULL;
+    pym->lenParameters          = -1;
+    pym->varArgsComponentType   = NULL;
+    pym->varArgsComponentTypeId = -1;
     pym->pyMethodName  = pyname;
     pym->isStatic      = -1;
     pym->returnTypeId  = -1;
+    pym->needsLocalFrame = 1;
+    pym->releaseGIL    = 1;
+#if JEP_VECTORCALL
+    pym->vectorcall    = pyjmethod_vectorcall;
+#endif
 
     return pym;
 }
 
+/*
+ * Small calls with only primitive and String arguments that return a
+ * primitive or a String create few enough local references to delete them
+ * directly instead of pushing a local frame for the call.
+ */
+static int pyjmethod_needs_local_frame(PyJMethodObject *self)
+{
+    int i;
+
+    if (self->isVarArgs || self->isKwArgs || self->lenParameters > STACK_JARGS) {
+        return 1;
+    }
+    if (self->returnTypeId == JOBJECT_ID || self->returnTypeId == JARRAY_ID
+            || self->returnTypeId == JCLASS_ID) {
+        return 1;
+    }
+    for (i = 0; i < self->lenParameters; i++) {
+        int paramTypeId = self->parameterTypeIds[i];
+        if (paramTypeId == JOBJECT_ID || paramTypeId == JARRAY_ID
+                || paramTypeId == JCLASS_ID) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+// delete the local references of the String arguments of a call without a local frame
+static void pyjmethod_delete_string_args(JNIEnv *env, PyJMethodObject *self,
+        jvalue *jargs, int len)
+{
+    int pos;
+
+    for (pos = 0; pos < len; pos++) {
+        if (self->parameterTypeIds[pos] == JSTRING_ID && jargs[pos].l) {
+            (*env)->DeleteLocalRef(env, jargs[pos].l);
+        }
+    }
+}
+
+
 // 1 if successful, 0 if failed.
 static int pyjmethod_init(JNIEnv *env, PyJMethodObject *self)
 {
@@ -94,10 +150,6 @@ static int pyjmethod_init(JNIEnv *env, PyJMethodObject *self)
         goto EXIT_ERROR;
     }
 
-    self->parameters    = (*env)->NewGlobalRef(env, paramArray);
-    self->lenParameters = (*env)->GetArrayLength(env, paramArray);
-
-
     modifier = java_lang_reflect_Member_getModifiers(env, self->rmethod);
     if (process_java_exception(env)) {
         goto EXIT_ERROR;
@@ -125,6 +177,10 @@ static int pyjmethod_init(JNIEnv *env, PyJMethodObject *self)
         if (process_java_exception(env)) {
             goto EXIT_ERROR;
         }
+        self->releaseGIL = jep_PyMethod_releaseGIL(env, jpymethod);
+        if (process_java_exception(env)) {
+            goto EXIT_ERROR;
+        }
     } else {
         if (process_java_exception(env)) {
             goto EXIT_ERROR;
@@ -136,6 +192,12 @@ static int pyjmethod_init(JNIEnv *env, PyJMethodObject *self)
         self->isKwArgs = 0;
     }
 
+    // must be last, lenParameters marks the method as initialized
+    if (!PyJMethod_InitParameters(self, env, paramArray)) {
+        goto EXIT_ERROR;
+    }
+    self->needsLocalFrame = pyjmethod_needs_local_frame(self);
+
     (*env)->PopLocalFrame(env, NULL);
     return 1;
 
@@ -149,18 +211,89 @@ EXIT_ERROR:
 }
 
 
+int PyJMethod_InitParameters(PyJMethodObject *self, JNIEnv *env,
+                             jobjectArray paramArray)
+{
+    int     i;
+    int     lenParameters;
+    jclass *parameterTypes   = NULL;
+    int    *parameterTypeIds = NULL;
+
+    lenParameters = (*env)->GetArrayLength(env, paramArray);
+    /* never allocate 0 bytes so a NULL result always means no memory */
+    parameterTypes = PyMem_Malloc(sizeof(jclass) * (lenParameters + 1));
+    parameterTypeIds = PyMem_Malloc(sizeof(int) * (lenParameters + 1));
+    if (!parameterTypes || !parameterTypeIds) {
+        PyMem_Free(parameterTypes);
+        PyMem_Free(parameterTypeIds);
+        PyErr_NoMemory();
+        return 0;
+    }
+
+    for (i = 0; i < lenParameters; i++) {
+        jclass paramType = (jclass) (*env)->GetObjectArrayElement(env, paramArray, i);
+        if (process_java_exception(env) || !paramType) {
+            goto EXIT_ERROR;
+        }
+        parameterTypeIds[i] = get_jtype(env, paramType);
+        if (process_java_exception(env)) {
+            (*env)->DeleteLocalRef(env, paramType);
+            goto EXIT_ERROR;
+        }
+        parameterTypes[i] = (*env)->NewGlobalRef(env, paramType);
+        (*env)->DeleteLocalRef(env, paramType);
+    }
+
+    if (lenParameters > 0 && parameterTypeIds[lenParameters - 1] == JARRAY_ID) {
+        jclass componentType = java_lang_Class_getComponentType(env,
+                               parameterTypes[lenParameters - 1]);
+        if (process_java_exception(env) || !componentType) {
+            goto EXIT_ERROR;
+        }
+        self->varArgsComponentTypeId = get_jtype(env, componentType);
+        if (process_java_exception(env)) {
+            (*env)->DeleteLocalRef(env, componentType);
+            goto EXIT_ERROR;
+        }
+        self->varArgsComponentType = (*env)->NewGlobalRef(env, componentType);
+        (*env)->DeleteLocalRef(env, componentType);
+    }
+
+    self->parameterTypes   = parameterTypes;
+    self->parameterTypeIds = parameterTypeIds;
+    self->lenParameters    = lenParameters;
+    return 1;
+
+EXIT_ERROR:
+    while (--i >= 0) {
+        (*env)->DeleteGlobalRef(env, parameterTypes[i]);
+    }
+    PyMem_Free(parameterTypes);
+    PyMem_Free(parameterTypeIds);
+    return 0;
+}
+
+
 static void pyjmethod_dealloc(PyJMethodObject *self)
 {
 #if USE_DEALLOC
     JNIEnv *env  = pyembed_get_env();
     if (env) {
-        if (self->parameters) {
-            (*env)->DeleteGlobalRef(env, self->parameters);
+        if (self->parameterTypes) {
+            int i;
+            for (i = 0; i < self->lenParameters; i++) {
+                (*env)->DeleteGlobalRef(env, self->parameterTypes[i]);
+            }
+        }
+        if (self->varArgsComponentType) {
+            (*env)->DeleteGlobalRef(env, self->varArgsComponentType);
         }
         if (self->rmethod) {
             (*env)->DeleteGlobalRef(env, self->rmethod);
         }
     }
+    PyMem_Free(self->parameterTypes);
+    PyMem_Free(self->parameterTypeIds);
 
     Py_CLEAR(self->pyMethodName);
 
@@ -176,7 +309,7 @@ int PyJMethod_Check(PyObject *obj)
 
 int PyJMethod_GetParameterCount(PyJMethodObject *method, JNIEnv *env)
 {
-    if (!method->parameters && !pyjmethod_init(env, method)) {
+    if (method->lenParameters < 0 && !pyjmethod_init(env, method)) {
         return -1;
     }
     return method->lenParameters;
@@ -184,56 +317,48 @@ int PyJMethod_GetParameterCount(PyJMethodObject *method, JNIEnv *env)
 
 
 int PyJMethod_CheckArguments(PyJMethodObject* method, JNIEnv *env,
-                             PyObject* args, PyObject* keywords)
+                             PyObject *const *args, Py_ssize_t nargs,
+                             int hasKeywords)
 {
     int matchTotal = 1;
     int parampos;
 
     int paramCount = PyJMethod_GetParameterCount(method, env);
-    if (keywords != NULL) {
-        if (PyDict_Size(keywords) == 0) {
-            keywords = NULL;
-        } else if (!method->isKwArgs) {
+    if (paramCount < 0) {
+        return -1;
+    }
+    if (hasKeywords) {
+        if (!method->isKwArgs) {
             return -1;
         } else {
             paramCount -= 1;
         }
     }
-    if (keywords == NULL && !method->isKwArgs) {
+    if (!hasKeywords && !method->isKwArgs) {
         // When kwargs are not given prefer non-kwargs methods over passing empty kwargs.
         matchTotal += 1;
     }
     if (!method->isVarArgs) {
-        if (paramCount != (PyTuple_Size(args) - 1)) {
+        if (paramCount != (nargs - 1)) {
             return 0;
         }
         matchTotal += 1;
     }
 
-    for (parampos = 0; parampos < PyTuple_Size(args) - 1; parampos += 1) {
-        PyObject* param       = PyTuple_GetItem(args, parampos + 1);
-        int       paramTypeId;
+    for (parampos = 0; parampos < nargs - 1; parampos += 1) {
+        PyObject* param       = args[parampos + 1];
         int       match;
         int       paramindex  = (method->isVarArgs
                                  && parampos > method->lenParameters - 1) ? method->lenParameters - 1 : parampos;
-        jclass    paramType   = (jclass) (*env)->GetObjectArrayElement(env,
-                                method->parameters, paramindex);
-
-        if (process_java_exception(env) || !paramType) {
-            matchTotal = -1;
-            break;
-        }
-
-        paramTypeId = get_jtype(env, paramType);
+        jclass    paramType   = method->parameterTypes[paramindex];
+        int       paramTypeId = method->parameterTypeIds[paramindex];
 
         match = pyarg_matches_jtype(env, param, paramType, paramTypeId);
         if (match == 0 && method->isVarArgs && paramTypeId == JARRAY_ID
                 && parampos >= method->lenParameters - 1) {
-            jclass arrayType = java_lang_Class_getComponentType(env, paramType);
-            int arrayTypeId = get_jtype(env, arrayType);
-            match += pyarg_matches_jtype(env, param, arrayType, arrayTypeId);
+            match += pyarg_matches_jtype(env, param, method->varArgsComponentType,
+                                         method->varArgsComponentTypeId);
         }
-        (*env)->DeleteLocalRef(env, paramType);
         if (PyErr_Occurred()) {
             matchTotal = -1;
             break;
@@ -271,13 +396,15 @@ int PyJMethod_CheckArguments(PyJMethodObject* method, JNIEnv *env,
  * whether it is static. All different variations are handled by this function
  * so there is alot of code to find the right JNI call.
  *
+ * The args are a C array so the same function can be used for tp_call and
+ * vectorcall, keywords is a dict or NULL.
  */
-static PyObject* pyjmethod_call(PyJMethodObject *self,
-                                PyObject *args,
-                                PyObject *keywords)
+static PyObject* pyjmethod_call_args(PyJMethodObject *self,
+                                     PyObject *const *args,
+                                     Py_ssize_t lenPyArgsGiven,
+                                     PyObject *keywords)
 {
     JNIEnv        *env              = NULL;
-    Py_ssize_t     lenPyArgsGiven   = 0;
     int            lenJArgsExpected = 0;
     /* The number of normal arguments before any varargs or kwargs */
     int            lenJArgsNormal   = 0;
@@ -286,6 +413,8 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
     PyObject      *result           = NULL;
     int            pos              = 0;
     jvalue        *jargs            = NULL;
+    /* jargs for calls with few arguments, to avoid allocating them */
+    jvalue         stackJArgs[STACK_JARGS];
     /* if params includes pyjarray instance */
     int            foundArray       = 0;
     /*
@@ -295,7 +424,11 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
      */
     int            needToDoVarArgs  = 0;
 
-    lenPyArgsGiven = PyTuple_Size(args);
+    if (lenPyArgsGiven < 1) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "First argument to a java method must be a java object.");
+        return NULL;
+    }
 
     env = pyembed_get_env();
     lenJArgsExpected = PyJMethod_GetParameterCount(self, env);
@@ -324,7 +457,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
         return NULL;
     }
 
-    firstArg = PyTuple_GetItem(args, 0);
+    firstArg = args[0];
     if (!PyJObject_Check(firstArg)) {
         PyErr_SetString(PyExc_RuntimeError,
                         "First argument to a java method must be a java object.");
@@ -341,54 +474,49 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
         return NULL;
     }
 
-    if ((*env)->PushLocalFrame(env, JLOCAL_REFS + lenJArgsExpected) != 0) {
+    if (self->needsLocalFrame
+            && (*env)->PushLocalFrame(env, JLOCAL_REFS + lenJArgsExpected) != 0) {
         process_java_exception(env);
         return NULL;
     }
 
-    jargs = (jvalue *) PyMem_Malloc(sizeof(jvalue) * lenJArgsExpected);
-    if (jargs == NULL) {
-        (*env)->PopLocalFrame(env, NULL);
-        return PyErr_NoMemory();
+    if (lenJArgsExpected <= STACK_JARGS) {
+        jargs = stackJArgs;
+    } else {
+        jargs = (jvalue *) PyMem_Malloc(sizeof(jvalue) * lenJArgsExpected);
+        if (jargs == NULL) {
+            (*env)->PopLocalFrame(env, NULL);
+            return PyErr_NoMemory();
+        }
     }
     for (pos = 0; pos < lenJArgsNormal; pos++) {
         PyObject *param = NULL;
-        int paramTypeId = -1;
-        jclass paramType = (jclass) (*env)->GetObjectArrayElement(env,
-                           self->parameters, pos);
+        int paramTypeId = self->parameterTypeIds[pos];
+        jclass paramType = self->parameterTypes[pos];
 
-        param = PyTuple_GetItem(args, pos + 1);
-        if (PyErr_Occurred()) {
-            goto EXIT_ERROR;
-        }
+        param = args[pos + 1];
 
-        paramTypeId = get_jtype(env, paramType);
         if (paramTypeId == JARRAY_ID) {
             foundArray = 1;
         }
 
         jargs[pos] = convert_pyarg_jvalue(env, param, paramType, paramTypeId, pos);
         if (PyErr_Occurred()) {
-            if (pos == (lenJArgsExpected - 1)
+            if (self->isVarArgs && pos == (lenJArgsExpected - 1)
                     && PyErr_ExceptionMatches(PyExc_TypeError)) {
-                if (self->isVarArgs) {
-                    /* Retry the last arg as array for varargs */
-                    PyErr_Clear();
-                    lenJArgsNormal -= 1;
-                    needToDoVarArgs = 1;
-                } else {
-                    goto EXIT_ERROR;
-                }
+                /* Retry the last arg as array for varargs */
+                PyErr_Clear();
+                lenJArgsNormal -= 1;
+                needToDoVarArgs = 1;
+            } else {
+                goto EXIT_ERROR;
             }
         }
-
-        (*env)->DeleteLocalRef(env, paramType);
     }
     if (needToDoVarArgs) {
         /* Need to process last arg as varargs. */
         PyObject *param = NULL;
-        jclass paramType = (jclass) (*env)->GetObjectArrayElement(env,
-                           self->parameters, lenJArgsNormal);
+        jclass paramType = self->parameterTypes[lenJArgsNormal];
         if (lenPyArgsGiven == (lenJArgsNormal + 1)) {
             /*
              * Python args are normally one longer than expected to allow for
@@ -396,7 +524,8 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
              */
             param = PyTuple_New(0);
         } else {
-            param = PyTuple_GetSlice(args, lenJArgsNormal + 1, lenPyArgsGiven);
+            param = pyargs_as_tuple(args + lenJArgsNormal + 1,
+                                    lenPyArgsGiven - lenJArgsNormal - 1);
         }
         if (PyErr_Occurred()) {
             goto EXIT_ERROR;
@@ -409,18 +538,15 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
         if (PyErr_Occurred()) {
             goto EXIT_ERROR;
         }
-        (*env)->DeleteLocalRef(env, paramType);
     }
     if (self->isKwArgs) {
         if (keywords) {
-            jclass paramType = (jclass) (*env)->GetObjectArrayElement(env,
-                               self->parameters, lenJArgsExpected - 1);
+            jclass paramType = self->parameterTypes[lenJArgsExpected - 1];
             jargs[lenJArgsExpected - 1] = convert_pyarg_jvalue(env, keywords, paramType,
                                           JOBJECT_ID, lenJArgsExpected - 1);
             if (PyErr_Occurred()) {
                 goto EXIT_ERROR;
             }
-            (*env)->DeleteLocalRef(env, paramType);
         } else {
             jargs[lenJArgsExpected - 1].l = NULL;
         }
@@ -432,7 +558,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
 
     case JSTRING_ID: {
         jstring jstr;
-        Py_BEGIN_ALLOW_THREADS;
+        JEP_BEGIN_ALLOW_THREADS_IF(self->releaseGIL);
 
         if (self->isStatic)
             jstr = (jstring) (*env)->CallStaticObjectMethodA(
@@ -456,7 +582,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
                            jargs);
         }
 
-        Py_END_ALLOW_THREADS;
+        JEP_END_ALLOW_THREADS_IF;
         if (!process_java_exception(env) && jstr != NULL) {
             result = jstring_As_PyString(env, jstr);
             (*env)->DeleteLocalRef(env, jstr);
@@ -467,7 +593,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
 
     case JARRAY_ID: {
         jobjectArray obj;
-        Py_BEGIN_ALLOW_THREADS;
+        JEP_BEGIN_ALLOW_THREADS_IF(self->releaseGIL);
 
         if (self->isStatic)
             obj = (jobjectArray) (*env)->CallStaticObjectMethodA(
@@ -490,7 +616,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
                           jargs);
         }
 
-        Py_END_ALLOW_THREADS;
+        JEP_END_ALLOW_THREADS_IF;
         if (!process_java_exception(env) && obj != NULL) {
             result = pyjarray_new(env, obj);
         }
@@ -500,7 +626,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
 
     case JCLASS_ID: {
         jobject obj;
-        Py_BEGIN_ALLOW_THREADS;
+        JEP_BEGIN_ALLOW_THREADS_IF(self->releaseGIL);
 
         if (self->isStatic)
             obj = (*env)->CallStaticObjectMethodA(
@@ -521,7 +647,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
                                                 jargs);
         }
 
-        Py_END_ALLOW_THREADS;
+        JEP_END_ALLOW_THREADS_IF;
         if (!process_java_exception(env) && obj != NULL) {
             result = PyJClass_Wrap(env, obj);
         }
@@ -531,7 +657,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
 
     case JOBJECT_ID: {
         jobject obj;
-        Py_BEGIN_ALLOW_THREADS;
+        JEP_BEGIN_ALLOW_THREADS_IF(self->releaseGIL);
 
         if (self->isStatic)
             obj = (*env)->CallStaticObjectMethodA(
@@ -552,7 +678,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
                                                 jargs);
         }
 
-        Py_END_ALLOW_THREADS;
+        JEP_END_ALLOW_THREADS_IF;
         if (!process_java_exception(env) && obj != NULL) {
             result = jobject_As_PyObject(env, obj);
         }
@@ -562,7 +688,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
 
     case JINT_ID: {
         jint ret;
-        Py_BEGIN_ALLOW_THREADS;
+        JEP_BEGIN_ALLOW_THREADS_IF(self->releaseGIL);
 
         if (self->isStatic)
             ret = (*env)->CallStaticIntMethodA(
@@ -583,7 +709,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
                                              jargs);
         }
 
-        Py_END_ALLOW_THREADS;
+        JEP_END_ALLOW_THREADS_IF;
         if (!process_java_exception(env)) {
             result = jint_As_PyObject(ret);
         }
@@ -593,7 +719,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
 
     case JBYTE_ID: {
         jbyte ret;
-        Py_BEGIN_ALLOW_THREADS;
+        JEP_BEGIN_ALLOW_THREADS_IF(self->releaseGIL);
 
         if (self->isStatic)
             ret = (*env)->CallStaticByteMethodA(
@@ -614,7 +740,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
                                               jargs);
         }
 
-        Py_END_ALLOW_THREADS;
+        JEP_END_ALLOW_THREADS_IF;
         if (!process_java_exception(env)) {
             result = jbyte_As_PyObject(ret);
         }
@@ -624,7 +750,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
 
     case JCHAR_ID: {
         jchar ret;
-        Py_BEGIN_ALLOW_THREADS;
+        JEP_BEGIN_ALLOW_THREADS_IF(self->releaseGIL);
 
         if (self->isStatic)
             ret = (*env)->CallStaticCharMethodA(
@@ -645,7 +771,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
                                               jargs);
         }
 
-        Py_END_ALLOW_THREADS;
+        JEP_END_ALLOW_THREADS_IF;
         if (!process_java_exception(env)) {
             result = jchar_As_PyObject(ret);
         }
@@ -654,7 +780,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
 
     case JSHORT_ID: {
         jshort ret;
-        Py_BEGIN_ALLOW_THREADS;
+        JEP_BEGIN_ALLOW_THREADS_IF(self->releaseGIL);
 
         if (self->isStatic)
             ret = (*env)->CallStaticShortMethodA(
@@ -675,7 +801,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
                                                jargs);
         }
 
-        Py_END_ALLOW_THREADS;
+        JEP_END_ALLOW_THREADS_IF;
         if (!process_java_exception(env)) {
             result = jshort_As_PyObject(ret);
         }
@@ -685,7 +811,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
 
     case JDOUBLE_ID: {
         jdouble ret;
-        Py_BEGIN_ALLOW_THREADS;
+        JEP_BEGIN_ALLOW_THREADS_IF(self->releaseGIL);
 
         if (self->isStatic)
             ret = (*env)->CallStaticDoubleMethodA(
@@ -706,7 +832,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
                                                 jargs);
         }
 
-        Py_END_ALLOW_THREADS;
+        JEP_END_ALLOW_THREADS_IF;
         if (!process_java_exception(env)) {
             result = jdouble_As_PyObject(ret);
         }
@@ -716,7 +842,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
 
     case JFLOAT_ID: {
         jfloat ret;
-        Py_BEGIN_ALLOW_THREADS;
+        JEP_BEGIN_ALLOW_THREADS_IF(self->releaseGIL);
 
         if (self->isStatic)
             ret = (*env)->CallStaticFloatMethodA(
@@ -737,7 +863,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
                                                jargs);
         }
 
-        Py_END_ALLOW_THREADS;
+        JEP_END_ALLOW_THREADS_IF;
         if (!process_java_exception(env)) {
             result = jfloat_As_PyObject(ret);
         }
@@ -747,7 +873,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
 
     case JLONG_ID: {
         jlong ret;
-        Py_BEGIN_ALLOW_THREADS;
+        JEP_BEGIN_ALLOW_THREADS_IF(self->releaseGIL);
 
         if (self->isStatic)
             ret = (*env)->CallStaticLongMethodA(
@@ -768,7 +894,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
                                               jargs);
         }
 
-        Py_END_ALLOW_THREADS;
+        JEP_END_ALLOW_THREADS_IF;
         if (!process_java_exception(env)) {
             result = jlong_As_PyObject(ret);
         }
@@ -778,7 +904,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
 
     case JBOOLEAN_ID: {
         jboolean ret;
-        Py_BEGIN_ALLOW_THREADS;
+        JEP_BEGIN_ALLOW_THREADS_IF(self->releaseGIL);
 
         if (self->isStatic)
             ret = (*env)->CallStaticBooleanMethodA(
@@ -799,7 +925,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
                                                  jargs);
         }
 
-        Py_END_ALLOW_THREADS;
+        JEP_END_ALLOW_THREADS_IF;
         if (!process_java_exception(env)) {
             result = jboolean_As_PyObject(ret);
         }
@@ -808,7 +934,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
     }
 
     default:
-        Py_BEGIN_ALLOW_THREADS;
+        JEP_BEGIN_ALLOW_THREADS_IF(self->releaseGIL);
 
         // i hereby anoint thee a void method
         if (self->isStatic)
@@ -822,13 +948,19 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
                                     self->methodId,
                                     jargs);
 
-        Py_END_ALLOW_THREADS;
+        JEP_END_ALLOW_THREADS_IF;
         process_java_exception(env);
         break;
     }
 
-    PyMem_Free(jargs);
-    (*env)->PopLocalFrame(env, NULL);
+    if (self->needsLocalFrame) {
+        (*env)->PopLocalFrame(env, NULL);
+    } else {
+        pyjmethod_delete_string_args(env, self, jargs, lenJArgsNormal);
+    }
+    if (jargs != stackJArgs) {
+        PyMem_Free(jargs);
+    }
 
     if (PyErr_Occurred()) {
         return NULL;
@@ -837,7 +969,7 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
     // re pin array objects if needed
     if (foundArray) {
         for (pos = 0; pos < lenJArgsNormal; pos++) {
-            PyObject *param = PyTuple_GetItem(args, pos + 1);     /* borrowed */
+            PyObject *param = args[pos + 1];     /* borrowed */
             if (param && pyjarray_check(param)) {
                 pyjarray_pin((PyJArrayObject *) param);
             }
@@ -851,11 +983,45 @@ static PyObject* pyjmethod_call(PyJMethodObject *self,
     return result;
 
 EXIT_ERROR:
-    PyMem_Free(jargs);
-    (*env)->PopLocalFrame(env, NULL);
+    if (self->needsLocalFrame) {
+        (*env)->PopLocalFrame(env, NULL);
+    } else {
+        pyjmethod_delete_string_args(env, self, jargs, pos);
+    }
+    if (jargs != stackJArgs) {
+        PyMem_Free(jargs);
+    }
     return NULL;
 }
 
+static PyObject* pyjmethod_call(PyJMethodObject *self,
+                                PyObject *args,
+                                PyObject *keywords)
+{
+    return pyjmethod_call_args(self, &PyTuple_GET_ITEM(args, 0),
+                               PyTuple_GET_SIZE(args), keywords);
+}
+
+#if JEP_VECTORCALL
+static PyObject* pyjmethod_vectorcall(PyObject *self, PyObject *const *args,
+                                      size_t nargsf, PyObject *kwnames)
+{
+    Py_ssize_t  nargs    = PyVectorcall_NARGS(nargsf);
+    PyObject   *keywords = NULL;
+    PyObject   *result   = NULL;
+
+    if (kwnames && PyTuple_GET_SIZE(kwnames) > 0) {
+        keywords = kwnames_as_dict(args + nargs, kwnames);
+        if (!keywords) {
+            return NULL;
+        }
+    }
+    result = pyjmethod_call_args((PyJMethodObject*) self, args, nargs, keywords);
+    Py_XDECREF(keywords);
+    return result;
+}
+#endif
+
 static PyObject* pyjmethod_descr_get(PyObject *func, PyObject *obj,
                                      PyObject *type)
 {
@@ -881,7 +1047,11 @@ PyTypeObject PyJMethod_Type = {
     sizeof(PyJMethodObject),
     0,
     (destructor) pyjmethod_dealloc,           /* tp_dealloc */
+#if JEP_VECTORCALL
+    offsetof(PyJMethodObject, vectorcall),    /* tp_vectorcall_offset */
+#else
     0,                                        /* tp_print */
+#endif
     0,                                        /* tp_getattr */
     0,                                        /* tp_setattr */
     0,                                        /* tp_compare */
@@ -895,7 +1065,13 @@ PyTypeObject PyJMethod_Type = {
     0,                                        /* tp_getattro */
     0,                                        /* tp_setattro */
     0,                                        /* tp_as_buffer */
+#if JEP_VECTORCALL
+    Py_TPFLAGS_DEFAULT |
+    Py_TPFLAGS_HAVE_VECTORCALL |
+    Py_TPFLAGS_METHOD_DESCRIPTOR,             /* tp_flags */
+#else
     Py_TPFLAGS_DEFAULT,                       /* tp_flags */
+#endif
     "jmethod",                                /* tp_doc */
     0,                                        /* tp_traverse */
     0,                                        /* tp_clear */
@@ -27,6 +27,17 @@
 
 #include "Jep.h"
 
+/*
+ * The maximum number of argument type combinations to remember for a single
+ * PyJMultiMethod. Once full, new combinations are resolved without caching.
+ */
+#define DISPATCH_CACHE_SIZE 32
+
+#if JEP_VECTORCALL
+static PyObject* pyjmultimethod_vectorcall(PyObject*, PyObject *const*, size_t,
+        PyObject*);
+#endif
+
 
 PyObject* PyJMultiMethod_New(PyObject* method1, PyObject* method2)
 {
@@ -44,6 +55,10 @@ PyObject* PyJMultiMethod_New(PyObject* method1, PyObject* method2)
     if (mm == NULL) {
         return NULL;
     }
+    mm->dispatchCache = NULL;
+#if JEP_VECTORCALL
+    mm->vectorcall = pyjmultimethod_vectorcall;
+#endif
     mm->methodList = PyList_New(2);
     if (mm->methodList == NULL) {
         PyObject_Del(mm);
@@ -69,6 +84,10 @@ int PyJMultiMethod_Append(PyObject* multimethod, PyObject* method)
         return -1;
     }
     mm = (PyJMultiMethodObject*) multimethod;
+    // a new overload may be a better match for previously resolved types
+    if (mm->dispatchCache) {
+        PyDict_Clear(mm->dispatchCache);
+    }
     return PyList_Append(mm->methodList, method);
 }
 
@@ -94,12 +113,68 @@ PyObject* PyJMultiMethod_GetName(PyObject* multimethod)
     return methodName;
 }
 
-static PyObject* pyjmultimethod_call(PyObject *multimethod,
-                                     PyObject *args,
-                                     PyObject *keywords)
+/*
+ * Check if the method chosen for an arg can be determined from the type of
+ * the arg alone. pyarg_matches_jtype() uses the length of a str to match a
+ * char and the java class of a PyJObject, and None is compatible with almost
+ * anything, so those args are always resolved without the cache.
+ */
+static int pyjmultimethod_is_cacheable_arg(PyObject *arg)
+{
+    if (PyUnicode_CheckExact(arg)) {
+        return PyUnicode_GET_LENGTH(arg) != 1;
+    }
+    return PyBool_Check(arg) || PyLong_CheckExact(arg) || PyFloat_CheckExact(arg)
+           || PyList_CheckExact(arg) || PyTuple_CheckExact(arg)
+           || PyDict_CheckExact(arg);
+}
+
+
+/*
+ * Build the key for the dispatch cache, a tuple containing the type of each
+ * arg after self followed by whether keywords were given. Returns NULL
+ * without an error set if the args cannot be cached.
+ */
+static PyObject* pyjmultimethod_dispatch_key(PyObject *const *args,
+        Py_ssize_t nargs, int hasKeywords)
+{
+    PyObject   *key = NULL;
+    Py_ssize_t  i;
+
+    for (i = 1; i < nargs; i++) {
+        if (!pyjmultimethod_is_cacheable_arg(args[i])) {
+            return NULL;
+        }
+    }
+
+    // one slot per arg minus self, plus one slot for keywords
+    key = PyTuple_New(nargs);
+    if (!key) {
+        return NULL;
+    }
+    for (i = 1; i < nargs; i++) {
+        PyObject *type = (PyObject*) Py_TYPE(args[i]);
+        Py_INCREF(type);
+        PyTuple_SET_ITEM(key, i - 1, type);
+    }
+    if (hasKeywords) {
+        Py_INCREF(Py_True);
+        PyTuple_SET_ITEM(key, nargs - 1, Py_True);
+    } else {
+        Py_INCREF(Py_False);
+        PyTuple_SET_ITEM(key, nargs - 1, Py_False);
+    }
+    return key;
+}
+
+
+/*
+ * Find the method that best matches the args. The first arg is self. Returns
+ * a borrowed reference or NULL with a python exception set.
+ */
+static PyJMethodObject* pyjmultimethod_resolve(PyJMultiMethodObject *mm,
+        PyObject *const *args, Py_ssize_t nargs, int hasKeywords)
 {
-    PyJMultiMethodObject* mm         = NULL;
-    PyObject* methodName             = NULL;
     /*
      * cand is a candidate method that passes the simple compatiblity check but
      * the complex check may not have been run.
@@ -113,26 +188,36 @@ static PyObject* pyjmultimethod_call(PyObject *multimethod,
     int               candMatch      = 0;
     Py_ssize_t        methodCount    = 0;
     Py_ssize_t        methodPosition = 0;
-    Py_ssize_t        argsSize       = 0;
+    Py_ssize_t        argsSize       = nargs - 1;
     JNIEnv*           env            = NULL;
+    PyObject*         dispatchKey    = NULL;
 
-    if (!PyJMultiMethod_Check(multimethod)) {
-        PyErr_SetString(PyExc_TypeError,
-                        "pyjmultimethod_call_internal received incorrect type");
+    dispatchKey = pyjmultimethod_dispatch_key(args, nargs, hasKeywords);
+    if (dispatchKey) {
+        if (mm->dispatchCache) {
+            cand = (PyJMethodObject*) PyDict_GetItemWithError(mm->dispatchCache,
+                    dispatchKey);
+            if (cand) {
+                Py_DECREF(dispatchKey);
+                return cand;
+            }
+        } else {
+            mm->dispatchCache = PyDict_New();
+        }
+    }
+    if (PyErr_Occurred()) {
+        Py_XDECREF(dispatchKey);
         return NULL;
     }
 
-    mm = (PyJMultiMethodObject*) multimethod;
-    methodName = PyJMultiMethod_GetName(multimethod);
     methodCount = PyList_Size(mm->methodList);
-    argsSize = PyTuple_Size(args) - 1;
     env = pyembed_get_env();
 
     for (methodPosition = 0; methodPosition < methodCount; methodPosition += 1) {
         PyJMethodObject* method = (PyJMethodObject*) PyList_GetItem(mm->methodList,
                                   methodPosition);
         int parameterCount = PyJMethod_GetParameterCount(method, env);
-        if (keywords && PyDict_Size(keywords) > 0 && !method->isKwArgs) {
+        if (hasKeywords && !method->isKwArgs) {
             /* 
 	     * keywords were passed in but this method does not support
 	     * keywords so keep looking at other methods.
@@ -145,7 +230,8 @@ static PyObject* pyjmultimethod_call(PyObject *multimethod,
                                              && argsSize >= parameterCount - 1)) {
             if (cand) {
                 if (!candMatch) {
-                    candMatch = PyJMethod_CheckArguments(cand, env, args, keywords);
+                    candMatch = PyJMethod_CheckArguments(cand, env, args, nargs,
+                                                         hasKeywords);
                 }
                 if (PyErr_Occurred()) {
                     cand = NULL;
@@ -154,7 +240,8 @@ static PyObject* pyjmultimethod_call(PyObject *multimethod,
                     // cand was not compatible, replace it with method.
                     cand = method;
                 } else {
-                    int methodMatch = PyJMethod_CheckArguments(method, env, args, keywords);
+                    int methodMatch = PyJMethod_CheckArguments(method, env, args,
+                                      nargs, hasKeywords);
                     if (methodMatch > candMatch) {
                         cand = method;
                         candMatch = methodMatch;
@@ -168,17 +255,57 @@ static PyObject* pyjmultimethod_call(PyObject *multimethod,
         }
     }
 
-    Py_DECREF(methodName);
-
     if (cand) {
-        return PyObject_Call((PyObject*) cand, args, keywords);
-    } else {
-        if (!PyErr_Occurred()) {
-            PyErr_SetString(PyExc_NameError, "No such Method.");
+        if (dispatchKey && !PyErr_Occurred()
+                && PyDict_Size(mm->dispatchCache) < DISPATCH_CACHE_SIZE) {
+            if (PyDict_SetItem(mm->dispatchCache, dispatchKey, (PyObject*) cand)) {
+                cand = NULL;
+            }
         }
+    } else if (!PyErr_Occurred()) {
+        PyErr_SetString(PyExc_NameError, "No such Method.");
+    }
+    Py_XDECREF(dispatchKey);
+    return cand;
+}
+
+
+static PyObject* pyjmultimethod_call(PyObject *multimethod,
+                                     PyObject *args,
+                                     PyObject *keywords)
+{
+    PyJMethodObject* cand = NULL;
+
+    if (!PyJMultiMethod_Check(multimethod)) {
+        PyErr_SetString(PyExc_TypeError,
+                        "pyjmultimethod_call_internal received incorrect type");
+        return NULL;
+    }
+
+    cand = pyjmultimethod_resolve((PyJMultiMethodObject*) multimethod,
+                                  &PyTuple_GET_ITEM(args, 0), PyTuple_GET_SIZE(args),
+                                  keywords && PyDict_Size(keywords) > 0);
+    if (!cand) {
+        return NULL;
+    }
+    return PyObject_Call((PyObject*) cand, args, keywords);
+}
+
+#if JEP_VECTORCALL
+static PyObject* pyjmultimethod_vectorcall(PyObject *multimethod,
+        PyObject *const *args, size_t nargsf, PyObject *kwnames)
+{
+    PyJMethodObject* cand = NULL;
+
+    cand = pyjmultimethod_resolve((PyJMultiMethodObject*) multimethod, args,
+                                  PyVectorcall_NARGS(nargsf),
+                                  kwnames && PyTuple_GET_SIZE(kwnames) > 0);
+    if (!cand) {
         return NULL;
     }
+    return PyObject_Vectorcall((PyObject*) cand, args, nargsf, kwnames);
 }
+#endif
 
 /* returns internal list as tuple since its not safe to modify the list*/
 static PyObject* pyjmultimethod_getmethods(PyObject* multimethod)
@@ -196,6 +323,7 @@ static PyObject* pyjmultimethod_getmethods(PyObject* multimethod)
 static void pyjmultimethod_dealloc(PyJMultiMethodObject *self)
 {
     Py_CLEAR(self->methodList);
+    Py_CLEAR(self->dispatchCache);
     PyObject_Del(self);
 }
 
@@ -225,7 +353,11 @@ PyTypeObject PyJMultiMethod_Type = {
     sizeof(PyJMultiMethodObject),
     0,
     (destructor) pyjmultimethod_dealloc,      /* tp_dealloc */
+#if JEP_VECTORCALL
+    offsetof(PyJMultiMethodObject, vectorcall), /* tp_vectorcall_offset */
+#else
     0,                                        /* tp_print */
+#endif
     0,                                        /* tp_getattr */
     0,                                        /* tp_setattr */
     0,                                        /* tp_compare */
@@ -239,7 +371,13 @@ PyTypeObject PyJMultiMethod_Type = {
     0,                                        /* tp_getattro */
     0,                                        /* tp_setattro */
     0,                                        /* tp_as_buffer */
+#if JEP_VECTORCALL
+    Py_TPFLAGS_DEFAULT |
+    Py_TPFLAGS_HAVE_VECTORCALL |
+    Py_TPFLAGS_METHOD_DESCRIPTOR,             /* tp_flags */
+#else
     Py_TPFLAGS_DEFAULT,                       /* tp_flags */
+#endif
     pyjmultimethod_doc,                       /* tp_doc */
     0,                                        /* tp_traverse */
     0,                                        /* tp_clear */
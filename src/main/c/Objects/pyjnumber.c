@@ -28,8 +28,24 @@
 
 #include "Jep.h"
 
+static PyObject* pyjnumber_int(PyObject*);
+
+/*
+ * Check if an object is a PyJNumberObject. Objects wrapped with the type of an
+ * interface or super class may be a java.lang.Number without having the
+ * struct of a PyJNumberObject.
+ */
+static int is_pyjnumber(PyObject *obj)
+{
+    PyNumberMethods *nb = Py_TYPE(obj)->tp_as_number;
+    return nb && nb->nb_int == pyjnumber_int;
+}
+
 static int pyjnumber_check(JNIEnv *env, PyObject* obj)
 {
+    if (is_pyjnumber(obj) && ((PyJNumberObject*) obj)->value) {
+        return 1;
+    }
     if (!PyJObject_Check(obj)) {
         return 0;
     }
@@ -40,12 +56,27 @@ static int pyjnumber_check(JNIEnv *env, PyObject* obj)
     return (*env)->IsInstanceOf(env, jobj->object, JNUMBER_TYPE);
 }
 
-static PyObject* java_number_to_pythonintlong(JNIEnv *env, PyObject* n)
+static void pyjnumber_dealloc(PyJNumberObject *self)
+{
+    Py_CLEAR(self->value);
+    PyJObject_Type.tp_dealloc((PyObject*) self);
+}
+
+/*
+ * boxed is true if the object is a boxed primitive, then the GIL is kept
+ * while the value is read.
+ */
+static PyObject* java_number_to_pythonintlong(JNIEnv *env, PyObject* n,
+        int boxed)
 {
     jlong      value;
     PyJObject *jnumber  = (PyJObject*) n;
 
-    value = java_lang_Number_longValue(env, jnumber->object);
+    if (boxed) {
+        value = java_lang_Number_longValue_boxed(env, jnumber->object);
+    } else {
+        value = java_lang_Number_longValue(env, jnumber->object);
+    }
     if (process_java_exception(env)) {
         return NULL;
     }
@@ -53,30 +84,71 @@ static PyObject* java_number_to_pythonintlong(JNIEnv *env, PyObject* n)
 }
 
 
-static PyObject* java_number_to_pythonfloat(JNIEnv *env, PyObject* n)
+static PyObject* java_number_to_pythonfloat(JNIEnv *env, PyObject* n,
+        int boxed)
 {
     jdouble    value;
     PyJObject *jnumber  = (PyJObject*) n;
 
-    value = java_lang_Number_doubleValue(env, jnumber->object);
+    if (boxed) {
+        value = java_lang_Number_doubleValue_boxed(env, jnumber->object);
+    } else {
+        value = java_lang_Number_doubleValue(env, jnumber->object);
+    }
     if (process_java_exception(env)) {
         return NULL;
     }
     return PyFloat_FromDouble(value);
 }
 
+/*
+ * Get the Python value of a boxed primitive, creating it the first time.
+ * Returns a borrowed reference or NULL without an exception set if the
+ * object is not a boxed primitive. The boxed classes are final so the class
+ * of the wrapper is the class of the object when it is one of them.
+ */
+static PyObject* java_number_cached_value(JNIEnv *env, PyObject* n)
+{
+    PyJNumberObject *jnumber = (PyJNumberObject*) n;
+
+    if (!is_pyjnumber(n)) {
+        return NULL;
+    }
+    if (!jnumber->value) {
+        jclass clazz = jnumber->clazz;
+        if ((*env)->IsSameObject(env, clazz, JINT_OBJ_TYPE)
+                || (*env)->IsSameObject(env, clazz, JLONG_OBJ_TYPE)
+                || (*env)->IsSameObject(env, clazz, JSHORT_OBJ_TYPE)
+                || (*env)->IsSameObject(env, clazz, JBYTE_OBJ_TYPE)) {
+            jnumber->value = java_number_to_pythonintlong(env, n, 1);
+        } else if ((*env)->IsSameObject(env, clazz, JDOUBLE_OBJ_TYPE)
+                   || (*env)->IsSameObject(env, clazz, JFLOAT_OBJ_TYPE)) {
+            jnumber->value = java_number_to_pythonfloat(env, n, 1);
+        }
+    }
+    return jnumber->value;
+}
+
 
 static PyObject* java_number_to_python(JNIEnv *env, PyObject* n)
 {
     PyJObject *jnumber  = (PyJObject*) n;
+    PyObject  *value    = java_number_cached_value(env, n);
+
+    if (value) {
+        Py_INCREF(value);
+        return value;
+    } else if (PyErr_Occurred()) {
+        return NULL;
+    }
 
     if ((*env)->IsInstanceOf(env, jnumber->object, JBYTE_OBJ_TYPE) ||
             (*env)->IsInstanceOf(env, jnumber->object, JSHORT_OBJ_TYPE) ||
             (*env)->IsInstanceOf(env, jnumber->object, JINT_OBJ_TYPE) ||
             (*env)->IsInstanceOf(env, jnumber->object, JLONG_OBJ_TYPE)) {
-        return java_number_to_pythonintlong(env, n);
+        return java_number_to_pythonintlong(env, n, 0);
     } else {
-        return java_number_to_pythonfloat(env, n);
+        return java_number_to_pythonfloat(env, n, 0);
     }
 }
 
@@ -253,15 +325,31 @@ static PyObject* pyjnumber_index(PyObject *x)
 
 static PyObject* pyjnumber_int(PyObject *x)
 {
-    JNIEnv *env = pyembed_get_env();
-    return java_number_to_pythonintlong(env, x);
+    JNIEnv   *env   = pyembed_get_env();
+    PyObject *value = java_number_cached_value(env, x);
+
+    if (value && PyLong_CheckExact(value)) {
+        Py_INCREF(value);
+        return value;
+    } else if (PyErr_Occurred()) {
+        return NULL;
+    }
+    return java_number_to_pythonintlong(env, x, value != NULL);
 }
 
 
 static PyObject* pyjnumber_float(PyObject *x)
 {
-    JNIEnv *env = pyembed_get_env();
-    return java_number_to_pythonfloat(env, x);
+    JNIEnv   *env   = pyembed_get_env();
+    PyObject *value = java_number_cached_value(env, x);
+
+    if (value && PyFloat_CheckExact(value)) {
+        Py_INCREF(value);
+        return value;
+    } else if (PyErr_Occurred()) {
+        return NULL;
+    }
+    return java_number_to_pythonfloat(env, x, value != NULL);
 }
 
 static PyObject* pyjnumber_richcompare(PyObject *self,
@@ -298,6 +386,7 @@ static Py_hash_t pyjnumber_hash(PyObject *self)
 
 static PyType_Slot slots[] = {
     {Py_tp_doc, "Jep java.lang.Number"},
+    {Py_tp_dealloc, (void*) pyjnumber_dealloc},
     {Py_tp_hash, (void*) pyjnumber_hash},
     {Py_tp_richcompare, (void*) pyjnumber_richcompare},
     {Py_nb_add, (void*) pyjnumber_add},
@@ -319,7 +408,7 @@ static PyType_Slot slots[] = {
 };
 PyType_Spec PyJNumber_Spec = {
     .name = "java.lang.Number",
-    .basicsize = sizeof(PyJObject),
+    .basicsize = sizeof(PyJNumberObject),
     .flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
     .slots = slots
 };
@@ -37,6 +37,7 @@ PyObject* PyJObject_New(JNIEnv *env, PyTypeObject* type, jobject obj,
                         jclass class)
 {
     PyJObject *pyjob = (PyJObject*) PyType_GenericAlloc(type, 0);
+    jclass typeClass = PyJType_GetClass(type);
 
     if (obj) {
         pyjob->object = (*env)->NewGlobalRef(env, obj);
@@ -44,7 +45,10 @@ PyObject* PyJObject_New(JNIEnv *env, PyTypeObject* type, jobject obj,
         /* This should only happen for pyjclass*/
         pyjob->object = NULL;
     }
-    if (class) {
+    if (typeClass) {
+        /* borrowed, the type outlives its instances */
+        pyjob->clazz = typeClass;
+    } else if (class) {
         pyjob->clazz = (*env)->NewGlobalRef(env, class);
     } else {
         class = (*env)->GetObjectClass(env, obj);
@@ -56,15 +60,224 @@ PyObject* PyJObject_New(JNIEnv *env, PyTypeObject* type, jobject obj,
     return (PyObject*) pyjob;
 }
 
+struct PyJObjectCacheEntry {
+    jint      hash;     /* identity hash code of the Java object */
+    PyObject *wrapper;  /* borrowed, NULL for an empty entry */
+};
+
+/* The number of entries allocated the first time a wrapper is cached */
+#define OBJECT_CACHE_INITIAL_CAPACITY 256
+
+/*
+ * The number of interpreters with an enabled cache, when it is 0 wrappers do
+ * not need to check for an entry when they are deallocated.
+ */
+static int objectCachesEnabled = 0;
+
+/*
+ * Find a wrapper of the type for a Java object in the cache. Returns a
+ * borrowed reference or NULL if the object is not in the cache.
+ */
+static PyObject* objectCacheLookup(JNIEnv *env, PyJObjectCache *cache,
+                                   PyTypeObject *type, jobject obj, jint hash)
+{
+    Py_ssize_t mask = cache->capacity - 1;
+    Py_ssize_t i;
+
+    if (!cache->entries) {
+        return NULL;
+    }
+    for (i = hash & mask; cache->entries[i].wrapper; i = (i + 1) & mask) {
+        PyJObjectCacheEntry *entry = &cache->entries[i];
+        if (entry->hash == hash && Py_TYPE(entry->wrapper) == type
+                && (*env)->IsSameObject(env,
+                                        ((PyJObject*) entry->wrapper)->object, obj)) {
+            return entry->wrapper;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Place an entry in the first empty slot for its hash, the entries must have
+ * room for at least one more entry.
+ */
+static void objectCacheInsert(PyJObjectCacheEntry *entries,
+                              Py_ssize_t capacity, PyJObjectCacheEntry *entry)
+{
+    Py_ssize_t mask = capacity - 1;
+    Py_ssize_t i;
+    for (i = entry->hash & mask; entries[i].wrapper; i = (i + 1) & mask) {
+    }
+    entries[i] = *entry;
+}
+
+/*
+ * Add a wrapper to the cache. Returns 0 on success and -1 on failure.
+ */
+static int objectCacheAdd(PyJObjectCache *cache, jint hash, PyObject *wrapper)
+{
+    PyJObjectCacheEntry entry;
+
+    // keep the load below 2/3 so probing stays short
+    if ((cache->size + 1) * 3 > cache->capacity * 2) {
+        Py_ssize_t newCapacity = cache->capacity ? cache->capacity * 2 :
+                                 OBJECT_CACHE_INITIAL_CAPACITY;
+        PyJObjectCacheEntry *newEntries = PyMem_Calloc(newCapacity,
+                                          sizeof(PyJObjectCacheEntry));
+        Py_ssize_t i;
+        if (!newEntries) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        for (i = 0; i < cache->capacity; i++) {
+            if (cache->entries[i].wrapper) {
+                objectCacheInsert(newEntries, newCapacity, &cache->entries[i]);
+            }
+        }
+        PyMem_Free(cache->entries);
+        cache->entries  = newEntries;
+        cache->capacity = newCapacity;
+    }
+
+    entry.hash    = hash;
+    entry.wrapper = wrapper;
+    objectCacheInsert(cache->entries, cache->capacity, &entry);
+    cache->size += 1;
+    return 0;
+}
+
+/*
+ * Remove the entry of a wrapper from the cache if there is one. The entries
+ * after it in the same run are shifted back so lookups never need to skip
+ * over removed entries.
+ */
+static void objectCacheRemove(PyJObjectCache *cache, jint hash,
+                              PyObject *wrapper)
+{
+    Py_ssize_t mask = cache->capacity - 1;
+    Py_ssize_t i, j, k;
+
+    if (!cache->entries) {
+        return;
+    }
+    for (i = hash & mask; cache->entries[i].wrapper != wrapper; i = (i + 1) & mask) {
+        if (!cache->entries[i].wrapper) {
+            return;
+        }
+    }
+    cache->size -= 1;
+    for (j = i;;) {
+        cache->entries[i].wrapper = NULL;
+        do {
+            j = (j + 1) & mask;
+            if (!cache->entries[j].wrapper) {
+                return;
+            }
+            k = cache->entries[j].hash & mask;
+            // move the entry at j unless its slot is cyclically in (i, j]
+        } while (i <= j ? (i < k && k <= j) : (i < k || k <= j));
+        cache->entries[i] = cache->entries[j];
+        i = j;
+    }
+}
+
+PyObject* PyJObject_NewCached(JNIEnv *env, PyTypeObject* type, jobject obj,
+                              jclass class)
+{
+    JepModuleState *state;
+    PyObject       *wrapper;
+    jint            hash;
+
+    if (!objectCachesEnabled || !obj) {
+        return PyJObject_New(env, type, obj, class);
+    }
+    state = pyembed_get_module_state();
+    if (!state) {
+        return NULL;
+    }
+    if (!state->objectCache.enabled) {
+        return PyJObject_New(env, type, obj, class);
+    }
+
+    hash = java_lang_System_identityHashCode(env, obj);
+    if (process_java_exception(env)) {
+        return NULL;
+    }
+    wrapper = objectCacheLookup(env, &state->objectCache, type, obj, hash);
+    if (wrapper) {
+        Py_INCREF(wrapper);
+        return wrapper;
+    }
+    wrapper = PyJObject_New(env, type, obj, class);
+    if (wrapper && objectCacheAdd(&state->objectCache, hash, wrapper)) {
+        Py_DECREF(wrapper);
+        return NULL;
+    }
+    return wrapper;
+}
+
+void PyJObject_SetCacheEnabled(PyJObjectCache *cache, int enabled)
+{
+    enabled = enabled ? 1 : 0;
+    if (cache->enabled == enabled) {
+        return;
+    }
+    cache->enabled = enabled;
+    objectCachesEnabled += enabled ? 1 : -1;
+    if (!enabled) {
+        PyMem_Free(cache->entries);
+        cache->entries  = NULL;
+        cache->capacity = 0;
+        cache->size     = 0;
+    }
+}
+
+/*
+ * Remove a wrapper that is being deallocated from the cache of the current
+ * interpreter. This can happen while a Python or Java exception is pending
+ * so both are saved and restored around the lookup of the hash code.
+ */
+static void pyjobject_uncache(JNIEnv *env, PyJObject *self)
+{
+    PyObject       *ptype, *pvalue, *ptrace;
+    JepModuleState *state;
+    jthrowable      pending;
+    jint            hash;
+
+    PyErr_Fetch(&ptype, &pvalue, &ptrace);
+    state = pyembed_get_module_state();
+    if (state && state->objectCache.entries) {
+        pending = (*env)->ExceptionOccurred(env);
+        if (pending) {
+            (*env)->ExceptionClear(env);
+        }
+        hash = java_lang_System_identityHashCode(env, self->object);
+        if ((*env)->ExceptionCheck(env)) {
+            (*env)->ExceptionClear(env);
+        } else {
+            objectCacheRemove(&state->objectCache, hash, (PyObject*) self);
+        }
+        if (pending) {
+            (*env)->Throw(env, pending);
+            (*env)->DeleteLocalRef(env, pending);
+        }
+    }
+    PyErr_Restore(ptype, pvalue, ptrace);
+}
+
 static void pyjobject_dealloc(PyJObject *self)
 {
 #if USE_DEALLOC
     JNIEnv *env = pyembed_get_env();
     if (env) {
+        if (objectCachesEnabled && self->object) {
+            pyjobject_uncache(env, self);
+        }
         if (self->object) {
             (*env)->DeleteGlobalRef(env, self->object);
         }
-        if (self->clazz) {
+        if (self->clazz && self->clazz != PyJType_GetClass(Py_TYPE(self))) {
             (*env)->DeleteGlobalRef(env, self->clazz);
         }
     }
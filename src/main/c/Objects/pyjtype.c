@@ -27,11 +27,274 @@
 
 #include "Jep.h"
 
+/*
+ * The metatype of the types created for java classes. Each type holds a
+ * global reference to its java class.
+ */
+typedef struct {
+    PyHeapTypeObject ht;
+    jclass           clazz;
+} PyJTypeObject;
+
 static PyTypeObject PyJType_Type;
 
-static PyTypeObject* pyjtype_get_cached(JNIEnv*, PyObject*, jclass);
+static PyTypeObject* pyjtype_get_cached(JNIEnv*, PyJTypeCache*, PyObject*,
+                                        jclass);
 static int addMethods(JNIEnv*, PyObject*, jclass);
 
+struct PyJTypeCacheEntry {
+    jint          hash;   /* identity hash code of clazz */
+    jclass        clazz;  /* global reference, NULL for an empty entry */
+    PyTypeObject *type;   /* NULL until a type is created for clazz */
+    int           kind;   /* set with PyJType_SetKind, 0 if unknown */
+    int           functional; /* 1 + value of PyJType_SetFunctional, 0 if unknown */
+};
+
+/* The number of entries allocated the first time a type is cached */
+#define TYPE_CACHE_INITIAL_CAPACITY 256
+
+/*
+ * Get the identity hash code of a class. java.lang.Class does not override
+ * hashCode() so Object.hashCode() is the identity hash code. The GIL is not
+ * released for this call because it is on the path of every conversion from
+ * a Java object to Python and the method cannot block.
+ */
+static jint getClassHash(JNIEnv *env, jclass clazz)
+{
+    static jmethodID hashCode = 0;
+    if (!JNI_METHOD(hashCode, env, JOBJECT_TYPE, "hashCode", "()I")) {
+        return 0;
+    }
+    return (*env)->CallIntMethod(env, clazz, hashCode);
+}
+
+/*
+ * Find the entry for a class in the cache. Returns NULL without an exception
+ * set if the class is not in the cache. The entry is only valid until the
+ * next entry is added.
+ */
+static PyJTypeCacheEntry* typeCacheFind(JNIEnv *env, PyJTypeCache *cache,
+                                        jclass clazz, jint hash)
+{
+    Py_ssize_t mask = cache->capacity - 1;
+    Py_ssize_t i;
+
+    if (!cache->entries) {
+        return NULL;
+    }
+    for (i = hash & mask; cache->entries[i].clazz; i = (i + 1) & mask) {
+        PyJTypeCacheEntry *entry = &cache->entries[i];
+        if (entry->hash == hash && (*env)->IsSameObject(env, entry->clazz, clazz)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Find the type for a class in the cache. Returns a borrowed reference or NULL
+ * without an exception set if there is no type for the class in the cache.
+ */
+static PyTypeObject* typeCacheLookup(JNIEnv *env, PyJTypeCache *cache,
+                                     jclass clazz, jint hash)
+{
+    PyJTypeCacheEntry *entry = typeCacheFind(env, cache, clazz, hash);
+    return entry ? entry->type : NULL;
+}
+
+/*
+ * Place an entry in the first empty slot for its hash, the entries must have
+ * room for at least one more entry.
+ */
+static void typeCacheInsert(PyJTypeCacheEntry *entries, Py_ssize_t capacity,
+                            PyJTypeCacheEntry *entry)
+{
+    Py_ssize_t mask = capacity - 1;
+    Py_ssize_t i;
+    for (i = entry->hash & mask; entries[i].clazz; i = (i + 1) & mask) {
+    }
+    entries[i] = *entry;
+}
+
+/*
+ * Get the entry for a class, adding an empty entry if the class is not in the
+ * cache. The cache keeps a global reference to the class. Returns NULL if an
+ * error occurs.
+ */
+static PyJTypeCacheEntry* typeCacheGetEntry(JNIEnv *env, PyJTypeCache *cache,
+        jclass clazz, jint hash)
+{
+    PyJTypeCacheEntry  entry;
+    PyJTypeCacheEntry *found = typeCacheFind(env, cache, clazz, hash);
+    Py_ssize_t         mask;
+    Py_ssize_t         i;
+
+    if (found) {
+        return found;
+    }
+
+    // keep the load below 2/3 so probing stays short
+    if ((cache->size + 1) * 3 > cache->capacity * 2) {
+        Py_ssize_t newCapacity = cache->capacity ? cache->capacity * 2 :
+                                 TYPE_CACHE_INITIAL_CAPACITY;
+        PyJTypeCacheEntry *newEntries = PyMem_Calloc(newCapacity,
+                                        sizeof(PyJTypeCacheEntry));
+        Py_ssize_t i;
+        if (!newEntries) {
+            PyErr_NoMemory();
+            return NULL;
+        }
+        for (i = 0; i < cache->capacity; i++) {
+            if (cache->entries[i].clazz) {
+                typeCacheInsert(newEntries, newCapacity, &cache->entries[i]);
+            }
+        }
+        PyMem_Free(cache->entries);
+        cache->entries  = newEntries;
+        cache->capacity = newCapacity;
+    }
+
+    entry.hash  = hash;
+    entry.clazz = (*env)->NewGlobalRef(env, clazz);
+    if (!entry.clazz) {
+        process_java_exception(env);
+        return NULL;
+    }
+    entry.type  = NULL;
+    entry.kind  = 0;
+    entry.functional = 0;
+    typeCacheInsert(cache->entries, cache->capacity, &entry);
+    cache->size += 1;
+
+    mask = cache->capacity - 1;
+    for (i = hash & mask; cache->entries[i].clazz != entry.clazz; i = (i + 1) & mask) {
+    }
+    return &cache->entries[i];
+}
+
+/*
+ * Add a type to the cache, the cache keeps a new reference to the type.
+ * Returns 0 on success and -1 on failure.
+ */
+static int typeCacheAdd(JNIEnv *env, PyJTypeCache *cache, jclass clazz,
+                        jint hash, PyTypeObject *type)
+{
+    PyJTypeCacheEntry *entry = typeCacheGetEntry(env, cache, clazz, hash);
+    if (!entry) {
+        return -1;
+    }
+    Py_INCREF(type);
+    Py_XDECREF(entry->type);
+    entry->type = type;
+    return 0;
+}
+
+int PyJType_GetKind(JNIEnv *env, jclass clazz, int *kind, PyTypeObject **type)
+{
+    JepModuleState    *state = pyembed_find_module_state();
+    PyJTypeCacheEntry *entry;
+    jint               hash;
+
+    if (!state) {
+        /* Without the _jep module nothing is cached. */
+        *kind = 0;
+        *type = NULL;
+        return 0;
+    }
+    hash = getClassHash(env, clazz);
+    if (process_java_exception(env)) {
+        return -1;
+    }
+    entry = typeCacheFind(env, &state->typeCache, clazz, hash);
+    *kind = entry ? entry->kind : 0;
+    *type = entry ? entry->type : NULL;
+    return 0;
+}
+
+int PyJType_SetKind(JNIEnv *env, jclass clazz, int kind)
+{
+    JepModuleState    *state = pyembed_find_module_state();
+    PyJTypeCacheEntry *entry;
+    jint               hash;
+
+    if (!state) {
+        return 0;
+    }
+    hash = getClassHash(env, clazz);
+    if (process_java_exception(env)) {
+        return -1;
+    }
+    entry = typeCacheGetEntry(env, &state->typeCache, clazz, hash);
+    if (!entry) {
+        return -1;
+    }
+    entry->kind = kind;
+    return 0;
+}
+
+int PyJType_GetFunctional(JNIEnv *env, jclass clazz, int *functional)
+{
+    JepModuleState    *state = pyembed_get_module_state();
+    PyJTypeCacheEntry *entry;
+    jint               hash;
+
+    if (!state) {
+        return -1;
+    }
+    hash = getClassHash(env, clazz);
+    if (process_java_exception(env)) {
+        return -1;
+    }
+    entry = typeCacheFind(env, &state->typeCache, clazz, hash);
+    *functional = entry ? entry->functional - 1 : -1;
+    return 0;
+}
+
+int PyJType_SetFunctional(JNIEnv *env, jclass clazz, int functional)
+{
+    JepModuleState    *state = pyembed_get_module_state();
+    PyJTypeCacheEntry *entry;
+    jint               hash;
+
+    if (!state) {
+        return -1;
+    }
+    hash = getClassHash(env, clazz);
+    if (process_java_exception(env)) {
+        return -1;
+    }
+    entry = typeCacheGetEntry(env, &state->typeCache, clazz, hash);
+    if (!entry) {
+        return -1;
+    }
+    entry->functional = functional ? 2 : 1;
+    return 0;
+}
+
+int PyJType_TraverseCache(PyJTypeCache *cache, visitproc visit, void *arg)
+{
+    Py_ssize_t i;
+    for (i = 0; i < cache->capacity; i++) {
+        Py_VISIT(cache->entries[i].type);
+    }
+    return 0;
+}
+
+void PyJType_FreeCache(JNIEnv *env, PyJTypeCache *cache)
+{
+    Py_ssize_t i;
+    for (i = 0; i < cache->capacity; i++) {
+        if (cache->entries[i].clazz) {
+            (*env)->DeleteGlobalRef(env, cache->entries[i].clazz);
+            Py_CLEAR(cache->entries[i].type);
+        }
+    }
+    PyMem_Free(cache->entries);
+    cache->entries  = NULL;
+    cache->capacity = 0;
+    cache->size     = 0;
+}
+
 /*
 * Flag to indicate if methods have been added to static types. Most types are
 * reinitialized for each interpreter but static types are shared between
@@ -46,12 +309,15 @@ static int staticTypesInitialized = 0;
  *
  * Returns a borrowed reference to the type on success, NULL on failure.
  */
-static PyTypeObject* addCustomTypeToTypeDict(JNIEnv *env, PyObject* fqnToPyType,
-        jclass class, PyTypeObject *type)
+static PyTypeObject* addCustomTypeToTypeDict(JNIEnv *env, PyJTypeCache *cache,
+        PyObject* fqnToPyType, jclass class, PyTypeObject *type)
 {
     if (PyDict_SetItemString(fqnToPyType, type->tp_name, (PyObject*) type)) {
         return NULL;
     }
+    if (typeCacheAdd(env, cache, class, getClassHash(env, class), type)) {
+        return NULL;
+    }
     /*
      * The custom wrapper types need to have their methods added since they are
      * not defined when the type is created. None of the types have fields so
@@ -70,8 +336,9 @@ static PyTypeObject* addCustomTypeToTypeDict(JNIEnv *env, PyObject* fqnToPyType,
  *
  * Returns a borrowed reference to the type on success, NULL on failure.
  */
-static PyTypeObject* addSpecToTypeDict(JNIEnv *env, PyObject* fqnToPyType,
-                                       jclass class, PyType_Spec *spec, PyTypeObject *base)
+static PyTypeObject* addSpecToTypeDict(JNIEnv *env, PyJTypeCache *cache,
+                                       PyObject* fqnToPyType, jclass class, PyType_Spec *spec,
+                                       PyTypeObject *base)
 {
     /* TODO Starting in 3.10 bases can be a single type so there will be no need to make a tuple. */
     PyObject *bases = NULL;
@@ -86,7 +353,8 @@ static PyTypeObject* addSpecToTypeDict(JNIEnv *env, PyObject* fqnToPyType,
     if (!type) {
         return NULL;
     }
-    PyTypeObject *result = addCustomTypeToTypeDict(env, fqnToPyType, class, type);
+    PyTypeObject *result = addCustomTypeToTypeDict(env, cache, fqnToPyType, class,
+                           type);
     Py_DECREF(type);
     return result;
 }
@@ -103,34 +371,35 @@ static PyTypeObject* addSpecToTypeDict(JNIEnv *env, PyObject* fqnToPyType,
  *
  * Returns 0 on success and -1 on failure
  */
-static int populateCustomTypeDict(JNIEnv *env, PyObject* fqnToPyType)
+static int populateCustomTypeDict(JNIEnv *env, PyJTypeCache *cache,
+                                  PyObject* fqnToPyType)
 {
-    if (!addSpecToTypeDict(env, fqnToPyType, JAUTOCLOSEABLE_TYPE,
+    if (!addSpecToTypeDict(env, cache, fqnToPyType, JAUTOCLOSEABLE_TYPE,
                            &PyJAutoCloseable_Spec, NULL)) {
         return -1;
     }
-    if (!addSpecToTypeDict(env, fqnToPyType, JITERATOR_TYPE, &PyJIterator_Spec,
+    if (!addSpecToTypeDict(env, cache, fqnToPyType, JITERATOR_TYPE, &PyJIterator_Spec,
                            NULL)) {
         return -1;
     }
-    PyTypeObject *pyjiterable = addSpecToTypeDict(env, fqnToPyType, JITERABLE_TYPE,
+    PyTypeObject *pyjiterable = addSpecToTypeDict(env, cache, fqnToPyType, JITERABLE_TYPE,
                                 &PyJIterable_Spec, NULL);
     if (!pyjiterable) {
         return -1;
     }
-    PyTypeObject *pyjcollection = addSpecToTypeDict(env, fqnToPyType,
+    PyTypeObject *pyjcollection = addSpecToTypeDict(env, cache, fqnToPyType,
                                   JCOLLECTION_TYPE, &PyJCollection_Spec, pyjiterable);
     if (!pyjcollection) {
         return -1;
     }
-    if (!addSpecToTypeDict(env, fqnToPyType, JLIST_TYPE, &PyJList_Spec,
+    if (!addSpecToTypeDict(env, cache, fqnToPyType, JLIST_TYPE, &PyJList_Spec,
                            pyjcollection)) {
         return -1;
     }
-    if (!addSpecToTypeDict(env, fqnToPyType, JMAP_TYPE, &PyJMap_Spec, NULL)) {
+    if (!addSpecToTypeDict(env, cache, fqnToPyType, JMAP_TYPE, &PyJMap_Spec, NULL)) {
         return -1;
     }
-    if (!addSpecToTypeDict(env, fqnToPyType, JNUMBER_TYPE, &PyJNumber_Spec,
+    if (!addSpecToTypeDict(env, cache, fqnToPyType, JNUMBER_TYPE, &PyJNumber_Spec,
                            &PyJObject_Type)) {
         return -1;
     }
@@ -139,16 +408,26 @@ static int populateCustomTypeDict(JNIEnv *env, PyObject* fqnToPyType)
                                  (PyObject * ) &PyJBuffer_Type)) {
             return -1;
         }
+        if (typeCacheAdd(env, cache, JBUFFER_TYPE, getClassHash(env, JBUFFER_TYPE),
+                         &PyJBuffer_Type)) {
+            return -1;
+        }
         if (PyDict_SetItemString(fqnToPyType, PyJObject_Type.tp_name,
                                  (PyObject * ) &PyJObject_Type)) {
             return -1;
         }
+        if (typeCacheAdd(env, cache, JOBJECT_TYPE, getClassHash(env, JOBJECT_TYPE),
+                         &PyJObject_Type)) {
+            return -1;
+        }
     } else {
         /* TODO In python 3.8 buffer protocol was added to spec so pybuffer type can use a spec */
-        if (!addCustomTypeToTypeDict(env, fqnToPyType, JBUFFER_TYPE, &PyJBuffer_Type)) {
+        if (!addCustomTypeToTypeDict(env, cache, fqnToPyType, JBUFFER_TYPE,
+                                     &PyJBuffer_Type)) {
             return -1;
         }
-        if (!addCustomTypeToTypeDict(env, fqnToPyType, JOBJECT_TYPE, &PyJObject_Type)) {
+        if (!addCustomTypeToTypeDict(env, cache, fqnToPyType, JOBJECT_TYPE,
+                                     &PyJObject_Type)) {
             return -1;
         }
         staticTypesInitialized = 1;
@@ -190,7 +469,8 @@ static void parseModule(PyObject* typeName, PyObject** moduleName,
  * struct and Python will not allow multiple inheritance of multiple types
  * with a struct, even if they are the same struct.
  */
-static PyObject* getBaseTypes(JNIEnv *env, PyObject *fqnToPyType, jclass clazz)
+static PyObject* getBaseTypes(JNIEnv *env, PyJTypeCache *cache,
+                              PyObject *fqnToPyType, jclass clazz)
 {
     /* Need to count the base types before tuple creation */
     jint numBases = 0;
@@ -219,7 +499,8 @@ static PyObject* getBaseTypes(JNIEnv *env, PyObject *fqnToPyType, jclass clazz)
     if (interface != JNI_TRUE) {
         /* For classes that are not interfaces, the super class is the first type */
         jclass super = java_lang_Class_getSuperclass(env, clazz);
-        PyObject* superType = (PyObject*) pyjtype_get_cached(env, fqnToPyType, super);
+        PyObject* superType = (PyObject*) pyjtype_get_cached(env, cache, fqnToPyType,
+                              super);
         (*env)->DeleteLocalRef(env, super);
         if (!superType) {
             Py_DECREF(bases);
@@ -235,7 +516,8 @@ static PyObject* getBaseTypes(JNIEnv *env, PyObject *fqnToPyType, jclass clazz)
         jclass superI = (jclass) (*env)->GetObjectArrayElement(env, interfaces,
                         interfacesIdx);
         interfacesIdx += 1;
-        PyObject* superType = (PyObject*) pyjtype_get_cached(env, fqnToPyType, superI);
+        PyObject* superType = (PyObject*) pyjtype_get_cached(env, cache, fqnToPyType,
+                              superI);
         (*env)->DeleteLocalRef(env, superI);
         if (!superType) {
             Py_DECREF(bases);
@@ -408,8 +690,9 @@ static int addFields(JNIEnv* env, PyObject* dict, jclass clazz)
  * Create a new PythonType object for the given Java class. The Python type
  * hierarchy will mirror the Java class hierarchy.
  */
-static PyTypeObject* pyjtype_get_new(JNIEnv *env, PyObject *fqnToPyType,
-                                     PyObject *typeName, jclass clazz)
+static PyTypeObject* pyjtype_get_new(JNIEnv *env, PyJTypeCache *cache,
+                                     PyObject *fqnToPyType, PyObject *typeName, jclass clazz,
+                                     jint hash)
 {
 
     if (!(*env)->IsAssignableFrom(env, clazz, JOBJECT_TYPE)) {
@@ -425,7 +708,7 @@ static PyTypeObject* pyjtype_get_new(JNIEnv *env, PyObject *fqnToPyType,
     }
 
     /* The Python types for the Java super class and any interfaces. */
-    PyObject* bases = getBaseTypes(env, fqnToPyType, clazz);
+    PyObject* bases = getBaseTypes(env, cache, fqnToPyType, clazz);
     if (!bases) {
         return NULL;
     }
@@ -466,7 +749,15 @@ static PyTypeObject* pyjtype_get_new(JNIEnv *env, PyObject *fqnToPyType,
     Py_XDECREF(moduleName);
     Py_XDECREF(shortName);
     if (type) {
+        ((PyJTypeObject*) type)->clazz = (*env)->NewGlobalRef(env, clazz);
+        /*
+         * The dict is kept for introspection and holds the most recent type
+         * for a name, the cache is used for finding the type of a class.
+         */
         PyDict_SetItem(fqnToPyType, typeName, (PyObject*) type);
+        if (typeCacheAdd(env, cache, clazz, hash, type)) {
+            Py_CLEAR(type);
+        }
     }
     return type;
 }
@@ -477,27 +768,49 @@ static PyTypeObject* pyjtype_get_new(JNIEnv *env, PyObject *fqnToPyType,
  * to allow for recursion while looking up super classes without needing to
  * look up the jepThread every time.
  */
-static PyTypeObject* pyjtype_get_cached(JNIEnv *env, PyObject *fqnToPyType,
-                                        jclass clazz)
+static PyTypeObject* pyjtype_get_cached(JNIEnv *env, PyJTypeCache *cache,
+                                        PyObject *fqnToPyType, jclass clazz)
 {
+    jint hash = getClassHash(env, clazz);
+    if (process_java_exception(env)) {
+        return NULL;
+    }
+    PyTypeObject *pyType = typeCacheLookup(env, cache, clazz, hash);
+    if (pyType) {
+        Py_INCREF(pyType);
+        return pyType;
+    }
     jstring className = java_lang_Class_getName(env, clazz);
     if (process_java_exception(env) || !className) {
         return NULL;
     }
     PyObject *pyClassName = jstring_As_PyString(env, className);
     (*env)->DeleteLocalRef(env, className);
-    PyTypeObject *pyType = (PyTypeObject*) PyDict_GetItem(fqnToPyType, pyClassName);
-    if (pyType) {
-        Py_INCREF(pyType);
-    } else {
-        pyType = pyjtype_get_new(env, fqnToPyType, pyClassName, clazz);
+    if (!pyClassName) {
+        return NULL;
     }
+    pyType = pyjtype_get_new(env, cache, fqnToPyType, pyClassName, clazz, hash);
     Py_DECREF(pyClassName);
     return pyType;
 }
 
 PyTypeObject* PyJType_Get(JNIEnv *env, jclass clazz)
 {
+    JepModuleState *state = pyembed_get_module_state();
+    if (!state) {
+        return NULL;
+    }
+    /* Fast path, most classes are already in the cache. */
+    jint hash = getClassHash(env, clazz);
+    if (process_java_exception(env)) {
+        return NULL;
+    }
+    PyTypeObject *pyType = typeCacheLookup(env, &state->typeCache, clazz, hash);
+    if (pyType) {
+        Py_INCREF(pyType);
+        return pyType;
+    }
+
     PyObject* modjep = pyembed_get_jep_module();
     if (!modjep) {
         return NULL;
@@ -506,16 +819,36 @@ PyTypeObject* PyJType_Get(JNIEnv *env, jclass clazz)
     if (!fqnToPyType) {
         return NULL;
     } else if (PyDict_Size(fqnToPyType) == 0) {
-        if (populateCustomTypeDict(env, fqnToPyType)) {
+        if (populateCustomTypeDict(env, &state->typeCache, fqnToPyType)) {
             Py_DECREF(fqnToPyType);
             return NULL;
         }
     }
-    PyTypeObject* result = pyjtype_get_cached(env, fqnToPyType, clazz);
+    PyTypeObject* result = pyjtype_get_cached(env, &state->typeCache, fqnToPyType,
+                           clazz);
     Py_DECREF(fqnToPyType);
     return result;
 }
 
+jclass PyJType_GetClass(PyTypeObject *type)
+{
+    if (Py_TYPE(type) == &PyJType_Type) {
+        return ((PyJTypeObject*) type)->clazz;
+    }
+    return NULL;
+}
+
+static void pyjtype_dealloc(PyJTypeObject *self)
+{
+#if USE_DEALLOC
+    JNIEnv *env = pyembed_get_env();
+    if (env && self->clazz) {
+        (*env)->DeleteGlobalRef(env, self->clazz);
+    }
+    PyType_Type.tp_dealloc((PyObject*) self);
+#endif
+}
+
 /*
  * Given a base type for a class, merge the mro from the base into the mro list
  * for a new type. The mro entries from the base type that are not in the list
@@ -608,9 +941,9 @@ static PyMethodDef pyjtype_methods[] = {
 static PyTypeObject PyJType_Type = {
     PyVarObject_HEAD_INIT(NULL, 0)
     "PyJType",                                /* tp_name */
-    0,                                        /* tp_basicsize */
+    sizeof(PyJTypeObject),                    /* tp_basicsize */
     0,                                        /* tp_itemsize */
-    0,                                        /* tp_dealloc */
+    (destructor) pyjtype_dealloc,             /* tp_dealloc */
     0,                                        /* tp_print */
     0,                                        /* tp_getattr */
     0,                                        /* tp_setattr */
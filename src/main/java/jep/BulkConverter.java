@@ -0,0 +1,202 @@
+/**
+ * Copyright (c) 2024 JEP AUTHORS.
+ *
+ * This file is licensed under the the zlib/libpng License.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any
+ * damages arising from the use of this software.
+ * 
+ * Permission is granted to anyone to use this software for any
+ * purpose, including commercial applications, and to alter it and
+ * redistribute it freely, subject to the following restrictions:
+ * 
+ *     1. The origin of this software must not be misrepresented; you
+ *     must not claim that you wrote the original software. If you use
+ *     this software in a product, an acknowledgment in the product
+ *     documentation would be appreciated but is not required.
+ * 
+ *     2. Altered source versions must be plainly marked as such, and
+ *     must not be misrepresented as being the original software.
+ * 
+ *     3. This notice may not be removed or altered from any source
+ *     distribution.
+ */
+package jep;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.HashMap;
+import java.util.Iterator;
+import java.util.List;
+
+/**
+ * Helper methods that allow the native code to move many objects across JNI
+ * with a single call instead of one call for every element. This class should
+ * not be used outside of the Jep project.
+ *
+ * @since 4.3
+ */
+class BulkConverter {
+
+    private BulkConverter() {
+    }
+
+    /**
+     * Get a range of elements from a list.
+     *
+     * @param list
+     *            the list containing the elements
+     * @param fromIndex
+     *            the index of the first element, inclusive
+     * @param toIndex
+     *            the index of the last element, exclusive
+     * @return the elements in an array as described in {@link #unbox(Object[])}
+     */
+    protected static Object toArray(List<?> list, int fromIndex, int toIndex) {
+        return unbox(list.subList(fromIndex, toIndex).toArray());
+    }
+
+    /**
+     * When every element of the array is a non-null Integer, Long, Double or
+     * Boolean the values are unboxed so the native code can read them all at
+     * once without calling a method on every element.
+     *
+     * @param values
+     *            the values to unbox
+     * @return an int[], long[], double[] or boolean[] if all the values have
+     *         the same boxed type, otherwise the values
+     */
+    protected static Object unbox(Object[] values) {
+        if (values.length == 0 || values[0] == null) {
+            return values;
+        }
+        Class<?> type = values[0].getClass();
+        if (type != Integer.class && type != Long.class
+                && type != Double.class && type != Boolean.class) {
+            return values;
+        }
+        for (Object value : values) {
+            if (value == null || value.getClass() != type) {
+                return values;
+            }
+        }
+        if (type == Integer.class) {
+            int[] result = new int[values.length];
+            for (int i = 0; i < values.length; i++) {
+                result[i] = (Integer) values[i];
+            }
+            return result;
+        } else if (type == Long.class) {
+            long[] result = new long[values.length];
+            for (int i = 0; i < values.length; i++) {
+                result[i] = (Long) values[i];
+            }
+            return result;
+        } else if (type == Double.class) {
+            double[] result = new double[values.length];
+            for (int i = 0; i < values.length; i++) {
+                result[i] = (Double) values[i];
+            }
+            return result;
+        } else {
+            boolean[] result = new boolean[values.length];
+            for (int i = 0; i < values.length; i++) {
+                result[i] = (Boolean) values[i];
+            }
+            return result;
+        }
+    }
+
+    /**
+     * Create a list from values that were converted from a Python list or
+     * tuple.
+     *
+     * @param values
+     *            an Object[] of converted values or a long[] or double[] of
+     *            values that are boxed into Long or Double
+     * @param unmodifiable
+     *            whether the list should be unmodifiable, for a tuple
+     * @return a new list containing the values
+     */
+    protected static List<Object> toList(Object values, boolean unmodifiable) {
+        List<Object> list;
+        if (values instanceof long[]) {
+            long[] longs = (long[]) values;
+            list = new ArrayList<>(longs.length);
+            for (long l : longs) {
+                list.add(l);
+            }
+        } else if (values instanceof double[]) {
+            double[] doubles = (double[]) values;
+            list = new ArrayList<>(doubles.length);
+            for (double d : doubles) {
+                list.add(d);
+            }
+        } else {
+            list = new ArrayList<>(Arrays.asList((Object[]) values));
+        }
+        if (unmodifiable) {
+            return Collections.unmodifiableList(list);
+        }
+        return list;
+    }
+
+    /**
+     * Create a map from keys and values that were converted from a Python
+     * dict.
+     *
+     * @param keys
+     *            the converted keys
+     * @param values
+     *            the converted values, in the same order as the keys
+     * @return a new HashMap sized so it does not need to grow
+     */
+    protected static HashMap<Object, Object> toHashMap(Object[] keys,
+            Object[] values) {
+        HashMap<Object, Object> map = new HashMap<>(
+                (int) (keys.length / 0.75f) + 1);
+        for (int i = 0; i < keys.length; i++) {
+            map.put(keys[i], values[i]);
+        }
+        return map;
+    }
+
+    /**
+     * Get the next elements from an iterator. If the iterator throws an
+     * exception after some elements were fetched, those elements are returned
+     * and the exception is stored in failure so it can be thrown after they
+     * are used.
+     *
+     * @param iterator
+     *            the iterator to advance
+     * @param max
+     *            the maximum number of elements to get
+     * @param failure
+     *            an array of length 1 that receives the exception
+     * @return up to max elements in an array as described in
+     *         {@link #unbox(Object[])}, an empty array when the iterator has
+     *         no more elements
+     */
+    protected static Object next(Iterator<?> iterator, int max,
+            Throwable[] failure) {
+        Object[] values = new Object[max];
+        int count = 0;
+        try {
+            while (count < max && iterator.hasNext()) {
+                Object value = iterator.next();
+                values[count++] = value;
+            }
+        } catch (RuntimeException | Error e) {
+            if (count == 0) {
+                throw e;
+            }
+            failure[0] = e;
+        }
+        if (count < max) {
+            values = Arrays.copyOf(values, count);
+        }
+        return unbox(values);
+    }
+}
@@ -24,6 +24,7 @@
  */
 package jep;
 
+import jep.python.FunctionalProxy;
 import jep.python.InvocationHandler;
 import jep.python.PyObject;
 
@@ -45,6 +46,11 @@ class Proxy {
         } catch (JepException e) {
             throw new IllegalArgumentException(e);
         }
+        Object direct = FunctionalProxy.newInstance(ih.getPyObject(),
+                targetInterface);
+        if (direct != null) {
+            return direct;
+        }
         Class<?> classes[] = { targetInterface };
         return java.lang.reflect.Proxy.newProxyInstance(loader, classes, ih);
     }
@@ -103,6 +109,9 @@ class Proxy {
      * @return the wrapped PyObject or null if there isn't one
      */
     protected static PyObject getPyObject(Object proxy) {
+        if (proxy instanceof FunctionalProxy) {
+            return ((FunctionalProxy) proxy).getPyObject();
+        }
         if (java.lang.reflect.Proxy.isProxyClass(proxy.getClass())) {
             java.lang.reflect.InvocationHandler ih = java.lang.reflect.Proxy
                     .getInvocationHandler(proxy);
@@ -57,4 +57,17 @@ public @interface PyMethod {
      * that is compatible with a Jep dict, such as a Map or PyObject.
      */
     public boolean kwargs() default false;
+
+    /**
+     * Set to false to keep the Python GIL while this Java method runs. By
+     * default the GIL is released during every call from Python to Java so
+     * other Python threads can run, but for short methods such as getters
+     * releasing and reacquiring the GIL can take longer than the method
+     * itself. This must only be used for methods that return quickly, do not
+     * block and never call back into Python. A call back into Python from
+     * the same thread will wait forever for the GIL it is holding.
+     *
+     * @since 4.3
+     */
+    public boolean releaseGIL() default true;
 }
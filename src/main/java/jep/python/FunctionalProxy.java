@@ -0,0 +1,294 @@
+/**
+ * Copyright (c) 2024 JEP AUTHORS.
+ *
+ * This file is licensed under the the zlib/libpng License.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any
+ * damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any
+ * purpose, including commercial applications, and to alter it and
+ * redistribute it freely, subject to the following restrictions:
+ *
+ *     1. The origin of this software must not be misrepresented; you
+ *     must not claim that you wrote the original software. If you use
+ *     this software in a product, an acknowledgment in the product
+ *     documentation would be appreciated but is not required.
+ *
+ *     2. Altered source versions must be plainly marked as such, and
+ *     must not be misrepresented as being the original software.
+ *
+ *     3. This notice may not be removed or altered from any source
+ *     distribution.
+ */
+package jep.python;
+
+import java.lang.reflect.UndeclaredThrowableException;
+import java.util.Comparator;
+import java.util.function.Consumer;
+import java.util.function.DoubleUnaryOperator;
+import java.util.function.Function;
+import java.util.function.IntPredicate;
+import java.util.function.IntUnaryOperator;
+import java.util.function.LongUnaryOperator;
+import java.util.function.Predicate;
+import java.util.function.ToDoubleFunction;
+import java.util.function.ToIntFunction;
+import java.util.function.ToLongFunction;
+
+import jep.JepException;
+
+/**
+ * Implementations of common functional interfaces that call a Python callable.
+ * A java.lang.reflect.Proxy boxes the arguments into an Object[] and the
+ * native code has to inspect the Method on every call. These classes call a
+ * native method for the exact signature of the interface instead, so
+ * primitive arguments and return values are passed directly. This matters for
+ * callbacks that are called many times, like a Comparator used for sorting or
+ * a Predicate used in a stream.
+ *
+ * @since 4.3
+ */
+public abstract class FunctionalProxy {
+
+    private final PyObject pyObject;
+
+    private FunctionalProxy(PyObject pyObject) {
+        this.pyObject = pyObject;
+    }
+
+    /**
+     * Create an instance of the interface that calls the Python callable.
+     *
+     * @param pyObject
+     *            the Python callable
+     * @param targetInterface
+     *            the functional interface to implement
+     * @return an instance of the interface or null if there is no
+     *         implementation for the interface
+     */
+    public static Object newInstance(PyObject pyObject,
+            Class<?> targetInterface) {
+        if (targetInterface == Comparator.class) {
+            return new ComparatorProxy(pyObject);
+        } else if (targetInterface == Predicate.class) {
+            return new PredicateProxy(pyObject);
+        } else if (targetInterface == Function.class) {
+            return new FunctionProxy(pyObject);
+        } else if (targetInterface == Consumer.class) {
+            return new ConsumerProxy(pyObject);
+        } else if (targetInterface == ToIntFunction.class) {
+            return new ToIntFunctionProxy(pyObject);
+        } else if (targetInterface == ToLongFunction.class) {
+            return new ToLongFunctionProxy(pyObject);
+        } else if (targetInterface == ToDoubleFunction.class) {
+            return new ToDoubleFunctionProxy(pyObject);
+        } else if (targetInterface == IntPredicate.class) {
+            return new IntPredicateProxy(pyObject);
+        } else if (targetInterface == IntUnaryOperator.class) {
+            return new IntUnaryOperatorProxy(pyObject);
+        } else if (targetInterface == LongUnaryOperator.class) {
+            return new LongUnaryOperatorProxy(pyObject);
+        } else if (targetInterface == DoubleUnaryOperator.class) {
+            return new DoubleUnaryOperatorProxy(pyObject);
+        }
+        return null;
+    }
+
+    public PyObject getPyObject() {
+        return pyObject;
+    }
+
+    /**
+     * Get the thread state for calling the Python callable. Errors are thrown
+     * the same way a java.lang.reflect.Proxy throws them because the methods
+     * of the interfaces cannot throw a JepException.
+     */
+    protected long tstate() {
+        try {
+            return pyObject.tstate();
+        } catch (JepException e) {
+            throw new UndeclaredThrowableException(e);
+        }
+    }
+
+    protected long target() {
+        return pyObject.pointer.pyObject;
+    }
+
+    private static native Object applyObject(long tstate, long target,
+            Object arg);
+
+    private static native void acceptObject(long tstate, long target,
+            Object arg);
+
+    private static native int compareObjects(long tstate, long target,
+            Object arg1, Object arg2);
+
+    private static native boolean testObject(long tstate, long target,
+            Object arg);
+
+    private static native int applyObjectAsInt(long tstate, long target,
+            Object arg);
+
+    private static native long applyObjectAsLong(long tstate, long target,
+            Object arg);
+
+    private static native double applyObjectAsDouble(long tstate,
+            long target, Object arg);
+
+    private static native boolean testInt(long tstate, long target, int arg);
+
+    private static native int applyIntAsInt(long tstate, long target,
+            int arg);
+
+    private static native long applyLongAsLong(long tstate, long target,
+            long arg);
+
+    private static native double applyDoubleAsDouble(long tstate,
+            long target, double arg);
+
+    private static final class ComparatorProxy extends FunctionalProxy
+            implements Comparator<Object> {
+
+        ComparatorProxy(PyObject pyObject) {
+            super(pyObject);
+        }
+
+        @Override
+        public int compare(Object o1, Object o2) {
+            return compareObjects(tstate(), target(), o1, o2);
+        }
+    }
+
+    private static final class PredicateProxy extends FunctionalProxy
+            implements Predicate<Object> {
+
+        PredicateProxy(PyObject pyObject) {
+            super(pyObject);
+        }
+
+        @Override
+        public boolean test(Object t) {
+            return testObject(tstate(), target(), t);
+        }
+    }
+
+    private static final class FunctionProxy extends FunctionalProxy
+            implements Function<Object, Object> {
+
+        FunctionProxy(PyObject pyObject) {
+            super(pyObject);
+        }
+
+        @Override
+        public Object apply(Object t) {
+            return applyObject(tstate(), target(), t);
+        }
+    }
+
+    private static final class ConsumerProxy extends FunctionalProxy
+            implements Consumer<Object> {
+
+        ConsumerProxy(PyObject pyObject) {
+            super(pyObject);
+        }
+
+        @Override
+        public void accept(Object t) {
+            acceptObject(tstate(), target(), t);
+        }
+    }
+
+    private static final class ToIntFunctionProxy extends FunctionalProxy
+            implements ToIntFunction<Object> {
+
+        ToIntFunctionProxy(PyObject pyObject) {
+            super(pyObject);
+        }
+
+        @Override
+        public int applyAsInt(Object value) {
+            return applyObjectAsInt(tstate(), target(), value);
+        }
+    }
+
+    private static final class ToLongFunctionProxy extends FunctionalProxy
+            implements ToLongFunction<Object> {
+
+        ToLongFunctionProxy(PyObject pyObject) {
+            super(pyObject);
+        }
+
+        @Override
+        public long applyAsLong(Object value) {
+            return applyObjectAsLong(tstate(), target(), value);
+        }
+    }
+
+    private static final class ToDoubleFunctionProxy extends FunctionalProxy
+            implements ToDoubleFunction<Object> {
+
+        ToDoubleFunctionProxy(PyObject pyObject) {
+            super(pyObject);
+        }
+
+        @Override
+        public double applyAsDouble(Object value) {
+            return applyObjectAsDouble(tstate(), target(), value);
+        }
+    }
+
+    private static final class IntPredicateProxy extends FunctionalProxy
+            implements IntPredicate {
+
+        IntPredicateProxy(PyObject pyObject) {
+            super(pyObject);
+        }
+
+        @Override
+        public boolean test(int value) {
+            return testInt(tstate(), target(), value);
+        }
+    }
+
+    private static final class IntUnaryOperatorProxy extends FunctionalProxy
+            implements IntUnaryOperator {
+
+        IntUnaryOperatorProxy(PyObject pyObject) {
+            super(pyObject);
+        }
+
+        @Override
+        public int applyAsInt(int operand) {
+            return applyIntAsInt(tstate(), target(), operand);
+        }
+    }
+
+    private static final class LongUnaryOperatorProxy extends FunctionalProxy
+            implements LongUnaryOperator {
+
+        LongUnaryOperatorProxy(PyObject pyObject) {
+            super(pyObject);
+        }
+
+        @Override
+        public long applyAsLong(long operand) {
+            return applyLongAsLong(tstate(), target(), operand);
+        }
+    }
+
+    private static final class DoubleUnaryOperatorProxy extends
+            FunctionalProxy implements DoubleUnaryOperator {
+
+        DoubleUnaryOperatorProxy(PyObject pyObject) {
+            super(pyObject);
+        }
+
+        @Override
+        public double applyAsDouble(double operand) {
+            return applyDoubleAsDouble(tstate(), target(), operand);
+        }
+    }
+}
@@ -26,7 +26,10 @@ package jep.python;
 
 import java.lang.reflect.Array;
 import java.lang.reflect.Method;
+import java.lang.reflect.Modifier;
+import java.nio.charset.StandardCharsets;
 import java.util.Arrays;
+import java.util.concurrent.ConcurrentHashMap;
 
 import jep.Jep;
 import jep.JepException;
@@ -122,7 +125,14 @@ public class InvocationHandler implements java.lang.reflect.InvocationHandler {
     @Override
     public Object invoke(Object proxy, Method method, Object[] args)
             throws Throwable {
-        if (method.isVarArgs()) {
+        ConcurrentHashMap<Method, MethodInfo> infos = METHOD_INFO
+                .get(method.getDeclaringClass());
+        MethodInfo info = infos.get(method);
+        if (info == null) {
+            info = new MethodInfo(method);
+            infos.putIfAbsent(method, info);
+        }
+        if (info.isVarArgs) {
             Object vargs = args[args.length - 1];
             int vlen = Array.getLength(vargs);
             Object[] nargs = Arrays.copyOf(args, args.length + vlen - 1);
@@ -132,7 +142,10 @@ public class InvocationHandler implements java.lang.reflect.InvocationHandler {
             args = nargs;
         }
         return invoke(proxy, pyObject.tstate(), pyObject.pointer.pyObject,
-                method, args, this.functionalInterface);
+                args, this.functionalInterface && info.isAbstract,
+                info.isAbstract, info.name, info.returnType,
+                info.declaringClass, info.methodID, info.parameterTypes,
+                info.primitiveReturnType);
     }
 
     public PyObject getPyObject() {
@@ -140,5 +153,139 @@ public class InvocationHandler implements java.lang.reflect.InvocationHandler {
     }
 
     private static native Object invoke(Object proxy, long tstate, long target,
-            Method method, Object[] args, boolean functionalInterface);
+            Object[] args, boolean callTarget, boolean isAbstract, byte[] name,
+            Class<?> returnType, Class<?> declaringClass, long methodID,
+            int[] parameterTypes, int primitiveReturnType);
+
+    private static native long getMethodID(Method method);
+
+    /*
+     * Ids for the types of parameters and return values of methods that are
+     * invoked from native code, these must match the J*_ID values in
+     * jep_util.h.
+     */
+    private static final int BOOLEAN_ID = 0;
+
+    private static final int INT_ID = 1;
+
+    private static final int LONG_ID = 2;
+
+    private static final int OBJECT_ID = 3;
+
+    private static final int VOID_ID = 5;
+
+    private static final int DOUBLE_ID = 6;
+
+    private static final int SHORT_ID = 7;
+
+    private static final int FLOAT_ID = 8;
+
+    private static final int CHAR_ID = 10;
+
+    private static final int BYTE_ID = 11;
+
+    private static int typeId(Class<?> type) {
+        if (!type.isPrimitive()) {
+            return OBJECT_ID;
+        } else if (type == Boolean.TYPE) {
+            return BOOLEAN_ID;
+        } else if (type == Byte.TYPE) {
+            return BYTE_ID;
+        } else if (type == Character.TYPE) {
+            return CHAR_ID;
+        } else if (type == Short.TYPE) {
+            return SHORT_ID;
+        } else if (type == Integer.TYPE) {
+            return INT_ID;
+        } else if (type == Long.TYPE) {
+            return LONG_ID;
+        } else if (type == Float.TYPE) {
+            return FLOAT_ID;
+        } else if (type == Double.TYPE) {
+            return DOUBLE_ID;
+        }
+        return VOID_ID;
+    }
+
+    /**
+     * The parts of a Method that are needed to invoke it. They are found the
+     * first time a Method is invoked so later calls do not use reflection.
+     * The cache is kept per declaring class so it does not prevent the class
+     * from being unloaded.
+     */
+    private static final ClassValue<ConcurrentHashMap<Method, MethodInfo>> METHOD_INFO =
+            new ClassValue<ConcurrentHashMap<Method, MethodInfo>>() {
+
+        @Override
+        protected ConcurrentHashMap<Method, MethodInfo> computeValue(
+                Class<?> type) {
+            return new ConcurrentHashMap<Method, MethodInfo>();
+        }
+    };
+
+    private static final class MethodInfo {
+
+        /** The name encoded as UTF-8 and terminated with a 0 for Python */
+        private final byte[] name;
+
+        private final boolean isAbstract;
+
+        private final boolean isVarArgs;
+
+        /**
+         * The type that the Python result is converted to. The invoke method
+         * must return an Object so primitive types are boxed and void accepts
+         * anything.
+         */
+        private final Class<?> returnType;
+
+        /*
+         * The rest is only used to call the default implementation when
+         * Python does not implement a method that is not abstract.
+         */
+        private final Class<?> declaringClass;
+
+        private final long methodID;
+
+        private final int[] parameterTypes;
+
+        private final int primitiveReturnType;
+
+        private MethodInfo(Method method) {
+            byte[] utf8 = method.getName().getBytes(StandardCharsets.UTF_8);
+            this.name = Arrays.copyOf(utf8, utf8.length + 1);
+            this.isAbstract = Modifier.isAbstract(method.getModifiers());
+            this.isVarArgs = method.isVarArgs();
+            this.declaringClass = method.getDeclaringClass();
+            this.methodID = isAbstract ? 0 : getMethodID(method);
+            Class<?>[] types = method.getParameterTypes();
+            this.parameterTypes = new int[types.length];
+            for (int i = 0; i < types.length; i += 1) {
+                this.parameterTypes[i] = typeId(types[i]);
+            }
+            Class<?> type = method.getReturnType();
+            this.primitiveReturnType = typeId(type);
+            if (!type.isPrimitive()) {
+                this.returnType = type;
+            } else if (type == Boolean.TYPE) {
+                this.returnType = Boolean.class;
+            } else if (type == Byte.TYPE) {
+                this.returnType = Byte.class;
+            } else if (type == Character.TYPE) {
+                this.returnType = Character.class;
+            } else if (type == Short.TYPE) {
+                this.returnType = Short.class;
+            } else if (type == Integer.TYPE) {
+                this.returnType = Integer.class;
+            } else if (type == Long.TYPE) {
+                this.returnType = Long.class;
+            } else if (type == Float.TYPE) {
+                this.returnType = Float.class;
+            } else if (type == Double.TYPE) {
+                this.returnType = Double.class;
+            } else {
+                this.returnType = Object.class;
+            }
+        }
+    }
 }
@@ -5,6 +5,7 @@ import java.io.File;
 import java.io.FileReader;
 import java.util.ArrayList;
 import java.util.Arrays;
+import java.util.Comparator;
 import java.util.List;
 import java.util.Map;
 
@@ -314,6 +315,15 @@ public class Test implements Runnable {
         return "No Args";
     }
 
+    @PyMethod(releaseGIL=false)
+    public int testKeepGIL(int i) {
+        return i + 1;
+    }
+
+    public Comparator<Object> testComparator(Comparator<Object> comparator) {
+        return comparator;
+    }
+
     public static Object[] test20Args(Object arg1, Object arg2, Object arg3,
             Object arg4, Object arg5, Object arg6, Object arg7, Object arg8,
             Object arg9, Object arg10, Object arg11, Object arg12, Object arg13,
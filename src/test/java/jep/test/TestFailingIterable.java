@@ -0,0 +1,41 @@
+package jep.test;
+
+import java.util.Iterator;
+
+/**
+ * An Iterable whose iterators throw an exception after returning a number of
+ * elements, to test that elements fetched before the exception reach python.
+ *
+ * @since 4.3
+ */
+public class TestFailingIterable implements Iterable<Integer> {
+
+    private final int count;
+
+    public TestFailingIterable(int count) {
+        this.count = count;
+    }
+
+    @Override
+    public Iterator<Integer> iterator() {
+        return new Iterator<Integer>() {
+
+            private int index = 0;
+
+            @Override
+            public boolean hasNext() {
+                return true;
+            }
+
+            @Override
+            public Integer next() {
+                if (index == count) {
+                    throw new IllegalStateException("Failed after " + count);
+                }
+                index += 1;
+                return index - 1;
+            }
+        };
+    }
+
+}
@@ -0,0 +1,36 @@
+"""
+Measures how many Java calls per second can be made from Python.
+
+This is not part of the unit tests. Run it inside jep, for example
+``jep src/test/python/benchmarks/bench_calls.py`` and compare the results of
+two builds to measure the effect of a change to the calling code.
+"""
+import timeit
+
+from java.lang import Integer, StringBuilder
+from java.util import ArrayList
+
+
+def report(name, stmt, setup, number):
+    timer = timeit.Timer(stmt, setup=setup, globals=globals())
+    best = min(timer.repeat(repeat=5, number=number))
+    print('{:<40} {:>12,.0f} calls/sec'.format(name, number / best))
+
+
+def main(number=100000):
+    report('obj.method(x)',
+           'lst.contains(1)', 'lst = ArrayList(); lst.add(1)', number)
+    report('obj.method()',
+           'lst.size()', 'lst = ArrayList()', number)
+    report('bound = obj.method; bound(x)',
+           'bound(1)', 'lst = ArrayList(); bound = lst.contains', number)
+    report('obj.overloaded(x)',
+           'sb.append(1)', 'sb = StringBuilder()', number)
+    report('Class.static_method(x)',
+           'Integer.valueOf(1)', '', number)
+    report('Class(x)',
+           'ArrayList(10)', '', number)
+
+
+if __name__ == '__main__':
+    main()
@@ -192,3 +192,96 @@ class TestArray(unittest.TestCase):
         self.assertTrue(base, jarray(1, JDOUBLE_ID))
         self.assertTrue(base, jarray(1, 'd'))
         self.assertTrue(base, jarray(1, Double.TYPE))
+
+    def test_buffer(self):
+        import struct
+        ar = jarray(4, JDOUBLE_ID)
+        for i in range(4):
+            ar[i] = i / 2
+        with memoryview(ar) as view:
+            self.assertEqual('d', view.format)
+            self.assertEqual(8, view.itemsize)
+            self.assertEqual([0.0, 0.5, 1.0, 1.5], view.tolist())
+            self.assertEqual((1.0,), struct.unpack_from('d', ar, 16))
+        self.assertEqual(b'\x01\x02\xff', bytes(jarray([1, 2, -1], JBYTE_ID)))
+        for typeid, fmt in ((JBOOLEAN_ID, '?'), (JCHAR_ID, 'H'),
+                            (JSHORT_ID, 'h'), (JINT_ID, 'i'),
+                            (JLONG_ID, 'q'), (JFLOAT_ID, 'f')):
+            with memoryview(jarray(1, typeid)) as view:
+                self.assertEqual(fmt, view.format)
+        with self.assertRaises(BufferError):
+            memoryview(jarray(1, Integer))
+
+    def test_buffer_write(self):
+        ar = jarray(3, JINT_ID)
+        with memoryview(ar) as view:
+            view[1] = 7
+        self.assertEqual('[0, 7, 0]', Arrays.toString(ar))
+        with memoryview(ar) as view:
+            Arrays.fill(ar, 3)
+            self.assertEqual([3, 3, 3], view.tolist())
+
+    def test_buffer_write_committed(self):
+        from array import array
+        ar = jarray(3, JINT_ID)
+        self.assertEqual('[0, 0, 0]', Arrays.toString(ar))
+        with memoryview(ar) as view:
+            view[1] = 7
+        self.assertEqual('[0, 7, 0]', Arrays.toString(ar))
+        self.assertEqual([0, 7, 0], list(ar))
+        with memoryview(ar) as view:
+            self.assertEqual('[0, 7, 0]', Arrays.toString(ar))
+            view[2] = 9
+            ar.copyFrom(array('i', [4]))
+        self.assertEqual('[4, 7, 9]', Arrays.toString(ar))
+        self.assertEqual([4, 7, 9], list(ar))
+
+    def test_modified_by_java(self):
+        ar = jarray(4, JINT_ID)
+        Arrays.fill(ar, 5)
+        self.assertEqual([5, 5], list(ar[1:3]))
+        ar[0] = 1
+        self.assertEqual('[1, 5, 5, 5]', Arrays.toString(ar))
+        Arrays.fill(ar, 1, 4, 2)
+        self.assertEqual([1, 2, 2, 2], list(ar))
+        self.assertEqual('[1, 2, 2, 2]', Arrays.toString(ar))
+
+    def test_copy_buffer(self):
+        from array import array
+        ar = jarray(4, JDOUBLE_ID)
+        ar.copyFrom(array('d', [1.5, 2.5]), 1)
+        self.assertEqual('[0.0, 1.5, 2.5, 0.0]', Arrays.toString(ar))
+        out = array('d', [0.0, 0.0, 0.0])
+        ar.copyInto(out, 1)
+        self.assertEqual([1.5, 2.5, 0.0], out.tolist())
+        Arrays.fill(ar, 3.0)
+        ar.copyFrom(array('d', [4.0]), 3)
+        ar.copyInto(out)
+        self.assertEqual([3.0, 3.0, 3.0], out.tolist())
+        self.assertEqual([3.0, 3.0, 3.0, 4.0], list(ar))
+        with self.assertRaises(ValueError):
+            ar.copyFrom(array('f', [1.0]))
+        with self.assertRaises(IndexError):
+            ar.copyFrom(array('d', [1.0, 2.0]), 3)
+        with self.assertRaises(TypeError):
+            jarray(1, Integer).copyFrom(array('i', [1]))
+        bar = jarray(3, JBYTE_ID)
+        bar.copyFrom(b'\x01\x02\xff')
+        self.assertEqual('[1, 2, -1]', Arrays.toString(bar))
+        buf = bytearray(2)
+        bar.copyInto(buf, 1)
+        self.assertEqual(b'\x02\xff', bytes(buf))
+
+    def test_jarray_from_buffer(self):
+        from array import array
+        from jep import jarrayFromBuffer
+        ar = jarrayFromBuffer(array('i', [1, 2, 3]), 'i')
+        self.assertEqual('[1, 2, 3]', Arrays.toString(ar))
+        ar = jarrayFromBuffer(b'ab', JBYTE_ID)
+        self.assertEqual('[97, 98]', Arrays.toString(ar))
+        ar = jarrayFromBuffer(array('d', [0.5]), Double.TYPE)
+        self.assertEqual([0.5], list(ar))
+        with self.assertRaises(ValueError):
+            jarrayFromBuffer(array('d', [0.5]), 'i')
+        with self.assertRaises(TypeError):
+            jarrayFromBuffer(b'ab', Integer)
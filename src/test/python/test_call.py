@@ -114,6 +114,38 @@ class TestTypes(unittest.TestCase):
             .getAsLong()
         self.assertTrue(result == sum(range(2, 1000, 2)))
 
+    def test_functional_interface_repeat(self):
+        from java.util import HashMap
+        m = HashMap()
+        for i in range(3):
+            m.computeIfAbsent(i, lambda k: k * 2)
+        self.assertEqual([0, 2, 4], [m.get(i) for i in range(3)])
+        # Object is not a functional interface, the callable is wrapped instead
+        a = ArrayList()
+        for i in range(3):
+            a.add(lambda: i)
+        self.assertEqual(3, a.size())
+
+    def test_functional_proxy(self):
+        from java.util import Collections
+        from java.util.stream import IntStream
+        values = ArrayList([5, 3, 9, 1])
+        Collections.sort(values, lambda a, b: b - a)
+        self.assertEqual([9, 5, 3, 1], list(values))
+        self.assertEqual(27.0, values.stream().mapToDouble(lambda v: v * 1.5).sum())
+        self.assertEqual(2, values.stream().filter(lambda v: v > 4).count())
+        seen = []
+        values.forEach(lambda v: seen.append(v) or object())
+        self.assertEqual([9, 5, 3, 1], seen)
+        self.assertEqual(20, IntStream.range(0, 5).filter(lambda i: i % 2 == 0).map(lambda i: i * i).sum())
+        compare = lambda a, b: len(a) - len(b)
+        self.assertIs(compare, self.test.testComparator(compare))
+        def fail(a, b):
+            raise ValueError('fail')
+        with self.assertRaises(RuntimeError) as e:
+            Collections.sort(values, fail)
+        self.assertIn('java.lang.reflect.UndeclaredThrowableException', str(e.exception))
+
     def test_observer(self):
         from java.util.concurrent import Executors
         a = list()
@@ -147,6 +179,12 @@ class TestTypes(unittest.TestCase):
         # Passing a tuple should convert the tuple elements to the varargs array.
         self.assertSequenceEqual(("1", "2", "3"), Test(("1", "2", "3")).getConstructorVarArgs());
 
+    def test_constructor_bad_first_arg(self):
+        from java.util.concurrent import ArrayBlockingQueue
+        with self.assertRaises(TypeError):
+            ArrayBlockingQueue('not an int', True)
+        self.assertEqual(2, ArrayBlockingQueue(2, True).remainingCapacity())
+
     def test_kwarg(self):
         expected = {"k1":"v1", "k2":"v2"};
         actual = self.test.testKwArgsMap(k1="v1", k2="v2")
@@ -180,3 +218,18 @@ class TestTypes(unittest.TestCase):
         self.assertEqual(expected, self.test.testKwArgsOverloaded(**expected))
 
 
+
+    def test_primitive_args(self):
+        Integer = jep.findClass('java.lang.Integer')
+        self.assertEqual(-1, Integer.compare(1, 2))
+        self.assertEqual('ff', Integer.toString(255, 16))
+        self.assertEqual(2, StringBuilder('abc').indexOf('c', 1))
+        with self.assertRaises(TypeError):
+            Integer.compare('1', 2)
+        with self.assertRaises(TypeError):
+            Integer.compare(1, '2')
+
+    def test_keep_gil(self):
+        self.assertEqual(2, self.test.testKeepGIL(1))
+        with self.assertRaises(TypeError):
+            self.test.testKeepGIL('1')
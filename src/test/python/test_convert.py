@@ -60,6 +60,81 @@ class TestConvert(unittest.TestCase):
         jep.setJavaToPythonConverter(Date, None)
         jep.setJavaToPythonConverter(Time, None)
 
+    def test_j2p_converter_inherited(self):
+        # Resolve Time before a converter is registered on the superclass
+        after = self.javaPassThrough(Time(1))
+        self.assertIsInstance(after, Time)
+        jep.setJavaToPythonConverter(Date, date_to_datetime)
+        after = self.javaPassThrough(Time(1))
+        self.assertIsInstance(after, datetime)
+        jep.setJavaToPythonConverter(Date, None)
+        after = self.javaPassThrough(Time(1))
+        self.assertIsInstance(after, Time)
+
+    def test_p2j_string(self):
+        from java.lang import StringBuilder
+        strings = ['', 'ascii', 'nul\0char', 'latin-1 \xe9\xff',
+                   'ucs-2 \u20ac', 'ucs-4 \U0001f600\U0010ffff', 'x' * 1000,
+                   '\xe9' * 1000, '\U0001f600' * 1000]
+        for s in strings:
+            self.assertEqual(s, self.javaPassThrough(s))
+            utf16_length = len(s.encode('utf-16-le')) // 2
+            self.assertEqual(utf16_length, StringBuilder(s).length())
+        self.assertEqual('\xe9', StringBuilder().append('\xe9').charAt(0))
+
+    def test_p2j_boxed_values(self):
+        from java.util import IdentityHashMap
+        values = [True, False, 0, 1, -128, 127]
+        boxes = IdentityHashMap()
+        for v in values:
+            boxes.put(v, v)
+        for v in values:
+            self.assertTrue(boxes.containsKey(v))
+            self.assertEqual(v, boxes.get(v))
+        self.assertEqual(1000, self.javaPassThrough(1000))
+        self.assertEqual(-129, self.javaPassThrough(-129))
+
+    def test_j2p_string(self):
+        from java.lang import String, StringBuilder
+        strings = ['', 'ascii', 'nul\0char', 'latin-1 \xe9\xff',
+                   'ucs-2 \u20ac', 'ucs-4 \U0001f600\U0010ffff',
+                   '\ufeffbom', 'x' * 1000, '\U0001f600' * 1000]
+        for s in strings:
+            self.assertEqual(s, StringBuilder(s).toString())
+            self.assertEqual(s, String(s).toString())
+
+    def test_j2p_string_cache(self):
+        from java.lang import StringBuilder
+        builder = StringBuilder('key')
+        self.assertIsNot(builder.toString(), builder.toString())
+        jep.setJavaStringCache(16)
+        try:
+            self.assertIs(builder.toString(), builder.toString())
+            self.assertEqual('key', builder.toString())
+            builder.append('\u20ac')
+            self.assertEqual('key\u20ac', builder.toString())
+            self.assertIs(builder.toString(), builder.toString())
+            builder.append('x' * 16)
+            self.assertIsNot(builder.toString(), builder.toString())
+        finally:
+            jep.setJavaStringCache(0)
+        self.assertRaises(ValueError, jep.setJavaStringCache, -1)
+
+    def test_j2p_string_cache_disabled(self):
+        from java.lang import StringBuilder
+        builder = StringBuilder('key')
+        jep.setJavaStringCache(16)
+        try:
+            cached = builder.toString()
+            self.assertIs(cached, builder.toString())
+        finally:
+            jep.setJavaStringCache(0)
+        self.assertIsNot(cached, builder.toString())
+        self.assertIsNot(builder.toString(), builder.toString())
+        empty = StringBuilder()
+        self.assertEqual('', empty.toString())
+        self.assertIsNot(builder.toString(), builder.toString())
+
     def tearDown(self):
         # make sure converters are deregistered since it shouldn't affect other tests.
         jep.setJavaToPythonConverter(Date, None)
@@ -64,3 +64,18 @@ class TestImport(unittest.TestCase):
         self.assertTrue(issubclass(Date, Object))
         self.assertTrue(issubclass(Date, Serializable))
 
+
+    def test_type_identity(self):
+        from java.util import ArrayList
+        self.assertIs(type(ArrayList()), type(ArrayList()))
+        self.assertIs(type(ArrayList()), ArrayList.__pytype__)
+
+    def test_type_per_classloader(self):
+        from java.net import URLClassLoader
+        location = Test.getProtectionDomain().getCodeSource().getLocation()
+        loader = URLClassLoader([location], None)
+        OtherTest = loader.loadClass(Test.getName())
+        self.assertEqual(Test.getName(), OtherTest.getName())
+        self.assertIsNot(type(Test()), type(OtherTest()))
+        self.assertIs(type(OtherTest()), type(OtherTest()))
+        loader.close()
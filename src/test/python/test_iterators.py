@@ -27,3 +27,71 @@ class TestIterators(unittest.TestCase):
         iterable = TestIteratorable()
         for item in iterable:
             self.assertEqual(item, next(iterator))
+
+    def test_iterable_chunks(self):
+        from java.util import ArrayList, LinkedHashSet
+        values = list(range(1000)) + [1.5, "string", None, True]
+        jset = LinkedHashSet()
+        for value in values:
+            jset.add(value)
+        self.assertEqual(values, list(jset))
+        it = iter(jset)
+        for value in it:
+            if value == 10:
+                break
+        self.assertEqual(values[11:], list(it))
+        self.assertEqual([], list(LinkedHashSet()))
+
+    def test_iterable_chunk_failure(self):
+        TestFailingIterable = jep.findClass('jep.test.TestFailingIterable')
+        for count in (0, 3, 256, 300):
+            seen = []
+            with self.assertRaises(Exception) as e:
+                for i in TestFailingIterable(count):
+                    seen.append(i)
+            self.assertEqual(list(range(count)), seen)
+            self.assertIn('Failed after ' + str(count), str(e.exception))
+
+    def test_list_modified_during_iteration(self):
+        from java.util import ArrayList
+        x = ArrayList()
+        for i in range(40):
+            x.add(i)
+        with self.assertRaises(RuntimeError):
+            for i in x:
+                if i == 0:
+                    x.remove(i)
+        with self.assertRaises(RuntimeError):
+            for i in x:
+                if i == 38:
+                    x.add(i)
+        self.assertEqual(40, len(list(x)))
+
+    def test_iterator_chunk_size(self):
+        from java.util import ArrayList
+        x = ArrayList()
+        for i in range(10):
+            x.add(i)
+        # Iterators from Java are not fetched in chunks by default
+        it = x.iterator()
+        self.assertEqual(0, next(it))
+        self.assertEqual(1, it.next())
+        self.assertEqual(2, next(it))
+        for i in it:
+            if i == 4:
+                break
+        self.assertEqual(list(range(5, 10)), list(it))
+        from java.util import LinkedList
+        x = LinkedList(x)
+        jep.setIteratorChunkSize(4)
+        try:
+            it = iter(x)
+            for i in it:
+                if i == 1:
+                    break
+            self.assertEqual(list(range(2, 10)), list(it))
+            jep.setIteratorChunkSize(1)
+            self.assertEqual(list(range(10)), list(x))
+        finally:
+            jep.setIteratorChunkSize(0)
+        self.assertRaises(ValueError, jep.setIteratorChunkSize, -1)
@@ -33,3 +33,19 @@ class TestJProxy(unittest.TestCase):
     def test_runnable(self):
         proxy = jep.jproxy(TestCallable(True), ["java.util.concurrent.Callable"])
         self.assertEqual(True, proxy.call())
+
+    def test_repeated_calls(self):
+        class Listener(object):
+            def __init__(self):
+                self.count = 0
+            def testIntArg(self, i):
+                self.count += i
+                return self.count
+        listener = Listener()
+        proxy = jep.jproxy(listener, ["jep.test.TestDefaultMethods"])
+        for i in range(100):
+            proxy.testIntArg(1)
+            # not implemented in Python so the default method is used
+            self.assertEqual(i, proxy.testLongArg(i))
+        self.assertEqual(100, listener.count)
+        self.assertEqual(101, proxy.testIntArg(1))
@@ -143,3 +143,49 @@ class TestLists(unittest.TestCase):
         jlist = ArrayList()
         jlist.add("string")
         self.assertEqual(next(iter(jlist)), "string")
+
+    def test_iterate_bulk(self):
+        from java.lang import Integer, Long
+        from java.util import LinkedList
+        values = [Integer.valueOf(i) for i in range(5000)]
+        values += [Long.valueOf(i) for i in range(100)]
+        values += [1.5, True, False, "string", None]
+        for ListType in (ArrayList, LinkedList):
+            jlist = ListType()
+            for value in values:
+                jlist.add(value)
+            self.assertEqual(list(jlist), values)
+            self.assertEqual(list(jlist.subList(0, 5000)), list(range(5000)))
+            self.assertEqual(list(jlist.subList(0, 0)), [])
+            for value in (1.5, True, 2**40):
+                jlist.clear()
+                jlist.add(value)
+                self.assertEqual(list(jlist), [value])
+                self.assertIs(type(list(jlist)[0]), type(value))
+
+    def test_iterate_break(self):
+        jlist = makeJavaList()
+        for i in jlist:
+            if i == 3:
+                break
+        self.assertEqual(3, i)
+        it = iter(jlist)
+        next(it)
+        jlist.add(COUNT)
+        self.assertEqual(list(it), list(range(1, COUNT + 1)))
+
+    def test_python_sequence_to_list(self):
+        sequences = [[], list(range(1000)), [1, 2**70], [0.5, 1.5],
+                     [1, 1.5, True, "string", None], [True, False],
+                     (1, 2, 3), (0.5,), ("a", "b")]
+        for seq in sequences:
+            jlist = self.test.testObjectPassThrough(seq)
+            self.assertIsInstance(jlist, List)
+            self.assertEqual(list(jlist), list(seq))
+            self.assertEqual([type(v) for v in jlist], [type(v) for v in seq])
+        jlist = self.test.testObjectPassThrough([1, 2])
+        jlist.add(3)
+        self.assertEqual(list(jlist), [1, 2, 3])
+        jlist = self.test.testObjectPassThrough((1, 2))
+        with self.assertRaises(Exception):
+            jlist.add(3)
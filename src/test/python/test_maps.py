@@ -82,3 +82,22 @@ class TestMaps(unittest.TestCase):
         pydict = dict(jmap)
         for k in pydict:
             self.assertEqual(pydict[k], jmap[k])
+
+    def test_dict_to_map(self):
+        from java.util import Map
+        from jep import findClass
+        test = findClass('jep.test.Test')()
+        pydict = {str(i): i for i in range(5000)}
+        pydict[None] = "none"
+        pydict[1.5] = {"nested": [1, 2]}
+        for d in ({}, makePythonDict(), pydict):
+            jmap = test.testObjectPassThrough(d)
+            self.assertIsInstance(jmap, HashMap)
+            self.assertEqual(len(d), len(jmap))
+            for k in d:
+                self.assertIn(k, jmap)
+        nested = jmap[1.5]
+        self.assertIsInstance(nested, Map)
+        self.assertEqual([1, 2], list(nested["nested"]))
+        jmap.put("new", 1)
+        self.assertEqual(1, jmap["new"])
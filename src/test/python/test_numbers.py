@@ -181,3 +181,24 @@ class TestNumbers(unittest.TestCase):
         b = Integer(-1)
         # -1 in Python means error code so they weirdly have the hash of -1 be -2
         self.assertEqual(-2, hash(b))
+
+    def test_boxed_value(self):
+        from java.lang import Float, Short
+        i, pi, j, pj, d, pd = self.get_values()
+        for _ in range(2):
+            self.assertEqual(pi, int(i))
+            self.assertEqual(float(pi), float(i))
+            self.assertEqual(int(pd), int(d))
+            self.assertEqual(pd, float(d))
+        self.assertEqual(2.5, Float(1.5) + 1)
+        self.assertEqual(-3, -Short(3))
+        self.assertTrue(Long(1) < Double(1.5))
+
+    def test_mutable_number(self):
+        a = AtomicInteger(1)
+        self.assertEqual(2, a + 1)
+        self.assertEqual(1, int(a))
+        a.set(5)
+        self.assertEqual(6, a + 1)
+        self.assertEqual(5, int(a))
+        self.assertEqual(hash(5), hash(a))
@@ -43,3 +43,44 @@ class TestObject(unittest.TestCase):
     def test_java_name(self):
         self.assertEqual(Object.java_name, "java.lang.Object")
         self.assertEqual(Object().java_name, "java.lang.Object")
+
+    def test_shared_class(self):
+        import gc
+        lists = [ArrayList() for i in range(100)]
+        self.assertTrue(all(type(l) is type(lists[0]) for l in lists))
+        del lists
+        gc.collect()
+        self.assertEqual('java.util.ArrayList', ArrayList().getClass().getName())
+        self.assertEqual('java.lang.Object', Object().getClass().getName())
+
+    def test_class_as_object(self):
+        holder = ArrayList()
+        holder.add(ArrayList)
+        holder.add(Object().getClass())
+        for i in range(3):
+            cls = holder.get(0)
+            self.assertEqual(0, cls().size())
+            self.assertEqual('java.lang.Object', holder.get(1).java_name)
+
+    def test_object_cache(self):
+        import gc
+        from java.util.concurrent import TimeUnit
+        self.assertIsNot(TimeUnit.SECONDS, TimeUnit.SECONDS)
+        jep.setJavaObjectCache(True)
+        try:
+            self.assertIs(TimeUnit.SECONDS, TimeUnit.SECONDS)
+            self.assertIs(TimeUnit.SECONDS, TimeUnit.valueOf('SECONDS'))
+            holder = ArrayList()
+            for i in range(1000):
+                holder.add(ArrayList())
+            lists = [holder.get(i) for i in range(1000)]
+            self.assertTrue(all(holder.get(i) is lists[i] for i in range(1000)))
+            self.assertEqual(lists[0], lists[1])
+            self.assertIsNot(lists[0], lists[1])
+            del lists
+            gc.collect()
+            lists = [holder.get(i) for i in range(0, 1000, 2)]
+            self.assertTrue(all(holder.get(i * 2) is l for i, l in enumerate(lists)))
+        finally:
+            jep.setJavaObjectCache(False)
+        self.assertIsNot(TimeUnit.SECONDS, TimeUnit.SECONDS)
@@ -90,3 +90,20 @@ class TestTypes(unittest.TestCase):
         self.assertEqual(TestOverload.varargs(0, "a"), 'int i, String...args')
         self.assertEqual(TestOverload.varargs("a", 0, "b", "c", "d"), 'String s, int i, String...args')
 
+
+    def test_repeated_calls(self):
+        # the same overloads must be chosen when resolution is cached
+        for i in range(3):
+            self.assertEqual(TestOverload.Object_or_String('abc'), 'String')
+            self.assertEqual(TestOverload.Object_or_String(0), 'Object')
+            self.assertEqual(TestOverload.Object_or_String(None), 'Object')
+            self.assertEqual(TestOverload.char_or_String('a'), 'String')
+            self.assertEqual(TestOverload.char_or_String('abc'), 'String')
+            self.assertEqual(TestOverload.any_primitive(1), 'long')
+            self.assertEqual(TestOverload.any_primitive(True), 'boolean')
+            self.assertEqual(TestOverload.any_primitive(1.0), 'double')
+            self.assertEqual(TestOverload.Object_or_List([]), 'List')
+            self.assertEqual(TestOverload.Object_or_List(ArrayList()), 'List')
+            self.assertEqual(TestOverload.Object_or_List(0), 'Object')
+            self.assertEqual(TestOverload.varargs(0, 1, 2), 'int...args')
+            self.assertEqual(TestOverload.varargs(0, "a"), 'int i, String...args')